@@ -0,0 +1,269 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/FastLinkedList.hpp"
+#include "containers/PoolAllocator.hpp"
+
+// FastLinkedList against std::forward_list and std::list, with the default allocator and with a pool allocator.
+// Build FastLinkedListUncheckedBench (compiled with HELPERS_UNCHECKED_ACCESS) to measure the cost of the bounds checks.
+
+namespace {
+
+using helpers::containers::ChunkedPoolResource;
+using helpers::containers::FastLinkedList;
+using helpers::containers::PoolAllocator;
+
+/// Elements in the list only differ by their key; the payload pads them to _Size bytes
+template <size_t _Size>
+struct Value {
+  static_assert(_Size > sizeof(uint64_t));
+
+  Value() = default;
+
+  explicit Value(uint64_t value_key) : key(value_key) {}
+
+  bool operator==(const Value& rhs) const noexcept { return key == rhs.key; }
+
+  uint64_t                                     key = 0;
+  std::array<uint8_t, _Size - sizeof(uint64_t)> payload;
+};
+
+template <size_t _N, size_t _Size>
+using Fast = FastLinkedList<Value<_Size>, _N>;
+
+template <size_t _N, size_t _Size>
+using FastStructOfArrays = FastLinkedList<Value<_Size>, _N, true>;
+
+template <size_t _N, size_t _Size>
+using StdForwardList = std::forward_list<Value<_Size>>;
+
+template <size_t _N, size_t _Size>
+using StdList = std::list<Value<_Size>>;
+
+template <size_t _N, size_t _Size>
+using PooledForwardList = std::forward_list<Value<_Size>, PoolAllocator<Value<_Size>, ChunkedPoolResource<>>>;
+
+template <size_t _N, size_t _Size>
+using PooledList = std::list<Value<_Size>, PoolAllocator<Value<_Size>, ChunkedPoolResource<>>>;
+
+template <typename _List, typename = void>
+struct UsesPoolAllocator : std::false_type {};
+
+template <typename _List>
+struct UsesPoolAllocator<_List, std::void_t<decltype(std::declval<typename _List::allocator_type&>().resource())>>
+    : std::true_type {};
+
+/// @brief Lists are allocated on the heap, a large FastLinkedList doesn't fit on the stack
+template <typename _List>
+std::unique_ptr<_List> MakeList() {
+  if constexpr (UsesPoolAllocator<_List>::value) {
+    // one resource per list type; its pools keep their chunks from one run to the next, like a long lived pool would
+    static ChunkedPoolResource<> resource;
+    return std::make_unique<_List>(typename _List::allocator_type(resource));
+  } else {
+    return std::make_unique<_List>();
+  }
+}
+
+/// @brief Pushes _N elements, then pops them all
+template <template <size_t, size_t> class _List, size_t _N, size_t _Size>
+void FillAndDrain(benchmark::State& state) {
+  const auto p_list = MakeList<_List<_N, _Size>>();
+
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < _N; ++i) {
+      p_list->push_front(Value<_Size>(i));
+    }
+
+    for (size_t i = 0; i < _N; ++i) {
+      p_list->pop_front();
+    }
+
+    benchmark::DoNotOptimize(p_list.get());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2 * _N));
+}
+
+/// @brief Keeps the list half full and pushes and pops bursts of 8 elements, so nodes are constantly recycled
+template <template <size_t, size_t> class _List, size_t _N, size_t _Size>
+void PushPopChurn(benchmark::State& state) {
+  constexpr size_t kBurst = 8;
+
+  const auto p_list = MakeList<_List<_N, _Size>>();
+  for (uint64_t i = 0; i < _N / 2; ++i) {
+    p_list->push_front(Value<_Size>(i));
+  }
+
+  for (auto _ : state) {
+    for (size_t burst_idx = 0; burst_idx < _N / kBurst / 2; ++burst_idx) {
+      for (uint64_t i = 0; i < kBurst; ++i) {
+        p_list->push_front(Value<_Size>(i));
+      }
+
+      for (size_t i = 0; i < kBurst; ++i) {
+        p_list->pop_front();
+      }
+    }
+
+    benchmark::DoNotOptimize(p_list.get());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _N));
+}
+
+/// @brief Full list with 8 distinct keys; removes every element with one key, then pushes them back
+template <template <size_t, size_t> class _List, size_t _N, size_t _Size>
+void RemoveByValue(benchmark::State& state) {
+  constexpr uint64_t kNumKeys = 8;
+
+  const auto p_list = MakeList<_List<_N, _Size>>();
+  for (uint64_t i = 0; i < _N; ++i) {
+    p_list->push_front(Value<_Size>(i % kNumKeys));
+  }
+
+  uint64_t key = 0;
+  for (auto _ : state) {
+    p_list->remove(Value<_Size>(key));
+
+    for (size_t i = 0; i < _N / kNumKeys; ++i) {
+      p_list->push_front(Value<_Size>(key));
+    }
+
+    key = (key + 1) % kNumKeys;
+    benchmark::DoNotOptimize(p_list.get());
+  }
+
+  // every element is compared once per remove
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _N));
+}
+
+/// @brief Pushes _N elements, then clears the list
+template <template <size_t, size_t> class _List, size_t _N, size_t _Size>
+void Clear(benchmark::State& state) {
+  const auto p_list = MakeList<_List<_N, _Size>>();
+
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < _N; ++i) {
+      p_list->push_front(Value<_Size>(i));
+    }
+
+    p_list->clear();
+    benchmark::DoNotOptimize(p_list.get());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _N));
+}
+
+enum class Operation { kPush, kPop, kFront, kRemove };
+
+/// @brief Random mix of 40% pushes, 35% pops, 20% reads of the front and 5% removals of one of 64 keys
+std::vector<std::pair<Operation, uint64_t>> MakeOperations() {
+  std::mt19937_64                         rg{42};
+  std::uniform_int_distribution<uint32_t> pick_percent(0, 99);
+  std::uniform_int_distribution<uint64_t> pick_key(0, 63);
+
+  std::vector<std::pair<Operation, uint64_t>> operations(4096);
+  for (auto& [operation, key] : operations) {
+    const auto percent = pick_percent(rg);
+
+    operation = percent < 40 ? Operation::kPush
+                : percent < 75 ? Operation::kPop
+                : percent < 95 ? Operation::kFront
+                               : Operation::kRemove;
+    key = pick_key(rg);
+  }
+
+  return operations;
+}
+
+/// @brief Runs the operations of MakeOperations() on a list that starts half full and never holds more than _N
+template <template <size_t, size_t> class _List, size_t _N, size_t _Size>
+void Mixed(benchmark::State& state) {
+  static const auto operations = MakeOperations();
+
+  const auto p_list = MakeList<_List<_N, _Size>>();
+
+  // std::forward_list has no size()
+  size_t num_elements = 0;
+  for (uint64_t i = 0; i < _N / 2; ++i, ++num_elements) {
+    p_list->push_front(Value<_Size>(i % 64));
+  }
+
+  for (auto _ : state) {
+    uint64_t key_sum = 0;
+
+    for (const auto& [operation, key] : operations) {
+      switch (operation) {
+        case Operation::kPush:
+          if (num_elements < _N) {
+            p_list->push_front(Value<_Size>(key));
+            ++num_elements;
+          }
+          break;
+        case Operation::kPop:
+          if (num_elements != 0) {
+            p_list->pop_front();
+            --num_elements;
+          }
+          break;
+        case Operation::kFront:
+          if (num_elements != 0) {
+            key_sum += p_list->front().key;
+          }
+          break;
+        case Operation::kRemove:
+          p_list->remove_if([&num_elements, key = key](const Value<_Size>& value) {
+            if (value.key == key) {
+              --num_elements;
+              return true;
+            }
+            return false;
+          });
+          break;
+      }
+    }
+
+    benchmark::DoNotOptimize(key_sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * operations.size()));
+}
+
+}  // namespace
+
+#define LIST_WORKLOADS(list, capacity, value_size)               \
+  BENCHMARK_TEMPLATE(FillAndDrain, list, capacity, value_size);  \
+  BENCHMARK_TEMPLATE(PushPopChurn, list, capacity, value_size);  \
+  BENCHMARK_TEMPLATE(RemoveByValue, list, capacity, value_size); \
+  BENCHMARK_TEMPLATE(Clear, list, capacity, value_size);         \
+  BENCHMARK_TEMPLATE(Mixed, list, capacity, value_size)
+
+#define ALL_LISTS(capacity, value_size)                     \
+  LIST_WORKLOADS(Fast, capacity, value_size);               \
+  LIST_WORKLOADS(FastStructOfArrays, capacity, value_size); \
+  LIST_WORKLOADS(StdForwardList, capacity, value_size);     \
+  LIST_WORKLOADS(StdList, capacity, value_size);            \
+  LIST_WORKLOADS(PooledForwardList, capacity, value_size);  \
+  LIST_WORKLOADS(PooledList, capacity, value_size)
+
+// by capacity, 16 byte elements
+ALL_LISTS(64, 16);
+ALL_LISTS(1024, 16);
+ALL_LISTS(16384, 16);
+
+// by element size, 1024 elements
+ALL_LISTS(1024, 64);
+ALL_LISTS(1024, 256);
+
+BENCHMARK_MAIN();
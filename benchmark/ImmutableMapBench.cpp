@@ -1,12 +1,71 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <malloc.h>
 #include <map>
+#include <memory>
+#include <new>
 #include <random>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "containers/ImmutableIntegerMap.hpp"
 #include "containers/ImmutableMap.hpp"
+#include "containers/ImmutableStringMap.hpp"
+
+//------------------------------------------------------------------------------
+// heap accounting, used to report the memory footprint of each container
+// tracks live bytes (allocations minus frees) so that temporaries used during construction aren't counted
+
+namespace {
+
+std::atomic<int64_t> live_heap_bytes{0};
+
+void* TrackAllocation(void* p_memory) {
+  if (p_memory == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  live_heap_bytes.fetch_add(static_cast<int64_t>(malloc_usable_size(p_memory)), std::memory_order_relaxed);
+  return p_memory;
+}
+
+void TrackFree(void* p_memory) noexcept {
+  if (p_memory != nullptr) {
+    live_heap_bytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(p_memory)), std::memory_order_relaxed);
+    std::free(p_memory);
+  }
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return TrackAllocation(std::malloc(size)); }
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const auto align = static_cast<size_t>(alignment);
+  return TrackAllocation(std::aligned_alloc(align, (size + align - 1) / align * align));
+}
+
+void operator delete(void* p_memory) noexcept { TrackFree(p_memory); }
+
+void operator delete(void* p_memory, size_t) noexcept { TrackFree(p_memory); }
+
+void operator delete(void* p_memory, std::align_val_t) noexcept { TrackFree(p_memory); }
+
+void operator delete(void* p_memory, size_t, std::align_val_t) noexcept { TrackFree(p_memory); }
+
+//------------------------------------------------------------------------------
 
 void StdMapLastKeyAccess(benchmark::State& state) {
   std::map<int32_t, int32_t> input_map;
@@ -166,4 +225,297 @@ BENCHMARK(StdMapRandomAccess)->RangeMultiplier(10)->Range(1, 1000000);
 BENCHMARK(StdUnorderedMapRandomAccess)->RangeMultiplier(10)->Range(1, 1000000);
 BENCHMARK(ImmutableMapRandomAccess)->RangeMultiplier(10)->Range(1, 1000000);
 
+//------------------------------------------------------------------------------
+// benchmark matrix: key types, value sizes, hit ratios, access patterns and construction cost
+
+namespace {
+
+using helpers::containers::BlockedBloomFilter;
+using helpers::containers::ImmutableIntegerMap;
+using helpers::containers::ImmutableMap;
+using helpers::containers::ImmutableStringMap;
+using helpers::containers::NoMembershipFilter;
+using helpers::containers::PiecewiseLinearIndex;
+
+/// Number of lookups timed per benchmark iteration
+constexpr size_t kNumLookups = 1 << 16;
+
+enum class AccessPattern {
+  /// every key is equally likely
+  kUniform,
+
+  /// a few keys are very hot (Zipf distribution, s = 0.99)
+  kZipfian,
+
+  /// keys are looked up in ascending order
+  kSequential
+};
+
+template <size_t _Size>
+struct Value {
+  std::array<uint8_t, _Size> bytes;
+};
+
+/// Keys in the map, and keys that are guaranteed not to be in the map
+template <typename _Key, typename _Tp>
+struct Dataset {
+  std::map<_Key, _Tp>           input_map;
+  std::unordered_map<_Key, _Tp> input_unordered_map;
+  std::vector<_Key>             hits;
+  std::vector<_Key>             misses;
+};
+
+template <typename _Key>
+_Key MakeKey(std::mt19937_64& rg) {
+  if constexpr (std::is_same<_Key, std::string>::value) {
+    // looks like a typical identifier: common prefix, random tail of varying length
+    static constexpr char kAlphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789_";
+
+    std::uniform_int_distribution<size_t> pick_length(4, 24);
+    std::uniform_int_distribution<size_t> pick_char(0, sizeof(kAlphabet) - 2);
+
+    std::string key = "key:";
+    for (auto length = pick_length(rg); length != 0; --length) {
+      key.push_back(kAlphabet[pick_char(rg)]);
+    }
+    return key;
+  } else {
+    return std::uniform_int_distribution<_Key>()(rg);
+  }
+}
+
+/// @brief Builds (once per key type, value type and size) a map of num_entries random keys and as many missing keys
+template <typename _Key, typename _Tp>
+const Dataset<_Key, _Tp>& GetDataset(size_t num_entries) {
+  static std::map<size_t, std::unique_ptr<Dataset<_Key, _Tp>>> datasets;
+
+  auto& p_dataset = datasets[num_entries];
+  if (p_dataset) {
+    return *p_dataset;
+  }
+
+  std::mt19937_64         rg{num_entries};
+  std::unordered_set<_Key> unique_keys;
+  std::vector<_Key>       keys;
+  while (keys.size() < 2 * num_entries) {
+    auto key = MakeKey<_Key>(rg);
+    if (unique_keys.insert(key).second) {
+      keys.push_back(std::move(key));
+    }
+  }
+
+  p_dataset = std::make_unique<Dataset<_Key, _Tp>>();
+  p_dataset->hits.assign(keys.begin(), keys.begin() + num_entries);
+  p_dataset->misses.assign(keys.begin() + num_entries, keys.end());
+
+  for (const auto& key : p_dataset->hits) {
+    p_dataset->input_map.emplace(key, _Tp{});
+  }
+  p_dataset->input_unordered_map.insert(p_dataset->input_map.begin(), p_dataset->input_map.end());
+
+  // sequential lookups walk the keys in order
+  std::sort(p_dataset->hits.begin(), p_dataset->hits.end());
+  std::sort(p_dataset->misses.begin(), p_dataset->misses.end());
+
+  return *p_dataset;
+}
+
+/// @brief Picks kNumLookups keys; hit_percent of them are in the map
+template <typename _Key, typename _Tp>
+std::vector<_Key> MakeLookups(const Dataset<_Key, _Tp>& dataset, int64_t hit_percent, AccessPattern pattern) {
+  const auto num_entries = dataset.hits.size();
+
+  std::mt19937_64                       rg{42};
+  std::bernoulli_distribution           is_hit(static_cast<double>(hit_percent) / 100.0);
+  std::uniform_int_distribution<size_t> pick_uniform(0, num_entries - 1);
+
+  // the Zipf rank is mapped through a permutation so that hot keys are scattered across the map
+  std::vector<double> zipf_cdf;
+  std::vector<size_t> rank_to_idx;
+  if (pattern == AccessPattern::kZipfian) {
+    double sum = 0.0;
+    for (size_t rank = 1; rank <= num_entries; ++rank) {
+      sum += 1.0 / std::pow(static_cast<double>(rank), 0.99);
+      zipf_cdf.push_back(sum);
+    }
+
+    rank_to_idx.resize(num_entries);
+    for (size_t idx = 0; idx < num_entries; ++idx) {
+      rank_to_idx[idx] = idx;
+    }
+    std::shuffle(rank_to_idx.begin(), rank_to_idx.end(), rg);
+  }
+  std::uniform_real_distribution<double> pick_zipf(0.0, zipf_cdf.empty() ? 1.0 : zipf_cdf.back());
+
+  std::vector<_Key> lookups;
+  lookups.reserve(kNumLookups);
+
+  for (size_t i = 0; i < kNumLookups; ++i) {
+    size_t idx = 0;
+    switch (pattern) {
+      case AccessPattern::kUniform:
+        idx = pick_uniform(rg);
+        break;
+      case AccessPattern::kZipfian:
+        idx = rank_to_idx[std::lower_bound(zipf_cdf.begin(), zipf_cdf.end(), pick_zipf(rg)) - zipf_cdf.begin()];
+        break;
+      case AccessPattern::kSequential:
+        idx = i % num_entries;
+        break;
+    }
+
+    lookups.push_back(is_hit(rg) ? dataset.hits[idx] : dataset.misses[idx]);
+  }
+
+  return lookups;
+}
+
+/// @brief Constructs a _Map from input
+/// @param bytes set to the heap memory owned by the new map
+template <typename _Map, typename _Input>
+std::unique_ptr<const _Map> MakeMap(const _Input& input, int64_t& bytes) {
+  const auto bytes_before = live_heap_bytes.load();
+
+  std::unique_ptr<const _Map> p_map;
+  if constexpr (std::is_constructible<_Map, const _Input&>::value) {
+    p_map = std::make_unique<const _Map>(input);
+  } else {
+    p_map = std::make_unique<const _Map>(input.begin(), input.end());
+  }
+
+  bytes = live_heap_bytes.load() - bytes_before;
+  return p_map;
+}
+
+/// @brief state.range(0) is the number of entries and state.range(1) is the percentage of lookups that hit
+template <typename _Map, AccessPattern _Pattern>
+void Lookup(benchmark::State& state) {
+  using key_type    = typename _Map::key_type;
+  using mapped_type = typename _Map::mapped_type;
+
+  const auto& dataset = GetDataset<key_type, mapped_type>(static_cast<size_t>(state.range(0)));
+  const auto  lookups = MakeLookups(dataset, state.range(1), _Pattern);
+
+  int64_t    map_bytes = 0;
+  const auto p_map     = MakeMap<_Map>(dataset.input_map, map_bytes);
+
+  for (auto _ : state) {
+    size_t num_found = 0;
+
+    for (const auto& key : lookups) {
+      num_found += p_map->count(key);
+    }
+
+    benchmark::DoNotOptimize(num_found);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lookups.size()));
+  state.counters["bytes_per_entry"] = static_cast<double>(map_bytes) / static_cast<double>(state.range(0));
+}
+
+/// @brief state.range(0) is the number of entries; _FromUnorderedMap selects the input container
+template <typename _Map, bool _FromUnorderedMap>
+void Construct(benchmark::State& state) {
+  using key_type    = typename _Map::key_type;
+  using mapped_type = typename _Map::mapped_type;
+
+  const auto& dataset = GetDataset<key_type, mapped_type>(static_cast<size_t>(state.range(0)));
+
+  int64_t map_bytes = 0;
+  for (auto _ : state) {
+    if constexpr (_FromUnorderedMap) {
+      benchmark::DoNotOptimize(MakeMap<_Map>(dataset.input_unordered_map, map_bytes));
+    } else {
+      benchmark::DoNotOptimize(MakeMap<_Map>(dataset.input_map, map_bytes));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_entry"] = static_cast<double>(map_bytes) / static_cast<double>(state.range(0));
+}
+
+template <typename _Key, size_t _ValueSize>
+using StdMap = std::map<_Key, Value<_ValueSize>>;
+
+template <typename _Key, size_t _ValueSize>
+using StdUnorderedMap = std::unordered_map<_Key, Value<_ValueSize>>;
+
+template <typename _Key, size_t _ValueSize>
+using Immutable = ImmutableMap<_Key, Value<_ValueSize>>;
+
+template <typename _Key, size_t _ValueSize>
+using ImmutableBloom = ImmutableMap<_Key, Value<_ValueSize>, std::less<_Key>, BlockedBloomFilter<_Key>>;
+
+template <typename _Key, size_t _ValueSize>
+using ImmutableLearned =
+    ImmutableMap<_Key, Value<_ValueSize>, std::less<_Key>, NoMembershipFilter<_Key>, PiecewiseLinearIndex<_Key>>;
+
+template <typename _Key, size_t _ValueSize>
+using ImmutableInteger = ImmutableIntegerMap<_Key, Value<_ValueSize>>;
+
+template <size_t _ValueSize>
+using ImmutableString = ImmutableStringMap<Value<_ValueSize>>;
+
+void LookupArgs(benchmark::internal::Benchmark* p_benchmark) {
+  p_benchmark->ArgNames({"entries", "hit%"})->ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {0, 20, 80, 100}});
+}
+
+void ConstructArgs(benchmark::internal::Benchmark* p_benchmark) {
+  p_benchmark->ArgNames({"entries"})->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+// lookups by key type, uniform access, 4 byte values
+#define LOOKUP_BY_KEY_TYPE(key_type)                                                                   \
+  BENCHMARK_TEMPLATE(Lookup, StdMap<key_type, 4>, AccessPattern::kUniform)->Apply(LookupArgs);          \
+  BENCHMARK_TEMPLATE(Lookup, StdUnorderedMap<key_type, 4>, AccessPattern::kUniform)->Apply(LookupArgs); \
+  BENCHMARK_TEMPLATE(Lookup, Immutable<key_type, 4>, AccessPattern::kUniform)->Apply(LookupArgs);       \
+  BENCHMARK_TEMPLATE(Lookup, ImmutableBloom<key_type, 4>, AccessPattern::kUniform)->Apply(LookupArgs)
+
+LOOKUP_BY_KEY_TYPE(int32_t);
+LOOKUP_BY_KEY_TYPE(uint64_t);
+LOOKUP_BY_KEY_TYPE(std::string);
+
+BENCHMARK_TEMPLATE(Lookup, ImmutableLearned<int32_t, 4>, AccessPattern::kUniform)->Apply(LookupArgs);
+BENCHMARK_TEMPLATE(Lookup, ImmutableLearned<uint64_t, 4>, AccessPattern::kUniform)->Apply(LookupArgs);
+BENCHMARK_TEMPLATE(Lookup, ImmutableInteger<int32_t, 4>, AccessPattern::kUniform)->Apply(LookupArgs);
+BENCHMARK_TEMPLATE(Lookup, ImmutableInteger<uint64_t, 4>, AccessPattern::kUniform)->Apply(LookupArgs);
+BENCHMARK_TEMPLATE(Lookup, ImmutableString<4>, AccessPattern::kUniform)->Apply(LookupArgs);
+
+// lookups by access pattern, 64 bit keys
+#define LOOKUP_BY_PATTERN(pattern)                                                        \
+  BENCHMARK_TEMPLATE(Lookup, StdMap<uint64_t, 4>, pattern)->Apply(LookupArgs);            \
+  BENCHMARK_TEMPLATE(Lookup, StdUnorderedMap<uint64_t, 4>, pattern)->Apply(LookupArgs);   \
+  BENCHMARK_TEMPLATE(Lookup, Immutable<uint64_t, 4>, pattern)->Apply(LookupArgs);         \
+  BENCHMARK_TEMPLATE(Lookup, ImmutableLearned<uint64_t, 4>, pattern)->Apply(LookupArgs);  \
+  BENCHMARK_TEMPLATE(Lookup, ImmutableInteger<uint64_t, 4>, pattern)->Apply(LookupArgs)
+
+LOOKUP_BY_PATTERN(AccessPattern::kZipfian);
+LOOKUP_BY_PATTERN(AccessPattern::kSequential);
+
+// lookups by value size, 64 bit keys, uniform access
+#define LOOKUP_BY_VALUE_SIZE(value_size)                                                                        \
+  BENCHMARK_TEMPLATE(Lookup, StdMap<uint64_t, value_size>, AccessPattern::kUniform)->Apply(LookupArgs);          \
+  BENCHMARK_TEMPLATE(Lookup, StdUnorderedMap<uint64_t, value_size>, AccessPattern::kUniform)->Apply(LookupArgs); \
+  BENCHMARK_TEMPLATE(Lookup, Immutable<uint64_t, value_size>, AccessPattern::kUniform)->Apply(LookupArgs);       \
+  BENCHMARK_TEMPLATE(Lookup, ImmutableInteger<uint64_t, value_size>, AccessPattern::kUniform)->Apply(LookupArgs)
+
+LOOKUP_BY_VALUE_SIZE(64);
+LOOKUP_BY_VALUE_SIZE(256);
+
+// construction cost and footprint
+#define CONSTRUCT(...)                                                       \
+  BENCHMARK_TEMPLATE(Construct, __VA_ARGS__, false)->Apply(ConstructArgs); \
+  BENCHMARK_TEMPLATE(Construct, __VA_ARGS__, true)->Apply(ConstructArgs)
+
+CONSTRUCT(Immutable<int32_t, 4>);
+CONSTRUCT(Immutable<uint64_t, 4>);
+CONSTRUCT(Immutable<uint64_t, 256>);
+CONSTRUCT(Immutable<std::string, 4>);
+CONSTRUCT(ImmutableBloom<uint64_t, 4>);
+CONSTRUCT(ImmutableLearned<uint64_t, 4>);
+CONSTRUCT(ImmutableInteger<uint64_t, 4>);
+CONSTRUCT(ImmutableString<4>);
+
 BENCHMARK_MAIN();
\ No newline at end of file
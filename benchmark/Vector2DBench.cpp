@@ -0,0 +1,182 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DExpression.hpp"
+#include "containers/Vector2DParallel.hpp"
+
+// row-major against tiled layouts, for access patterns that step from one row to the next
+
+namespace {
+
+using helpers::containers::RowMajorLayout;
+using helpers::containers::TiledLayout;
+using helpers::containers::Vector2D;
+
+template <typename _Layout>
+Vector2D<uint32_t, _Layout> MakeImage(size_t size) {
+  Vector2D<uint32_t, _Layout> image(size, size);
+  image.for_each_by_tile([](size_t row, size_t column, uint32_t& pixel) { pixel = row ^ column; });
+  return image;
+}
+
+/// @brief state.range(0) is the width and height of the image; sums it one column after the other
+template <typename _Layout>
+void ColumnWalk(benchmark::State& state) {
+  const auto size  = static_cast<size_t>(state.range(0));
+  const auto image = MakeImage<_Layout>(size);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+
+    for (size_t column = 0; column < size; ++column) {
+      for (size_t row = 0; row < size; ++row) {
+        sum += image(row, column);
+      }
+    }
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size * size));
+}
+
+/// @brief state.range(0) is the width and height of the image; 3x3 box filter, in the layout's storage order
+template <typename _Layout>
+void Stencil(benchmark::State& state) {
+  const auto size   = static_cast<size_t>(state.range(0));
+  const auto image  = MakeImage<_Layout>(size);
+  auto       output = MakeImage<_Layout>(size);
+
+  for (auto _ : state) {
+    output.for_each_by_tile([&image, size](size_t row, size_t column, uint32_t& pixel) {
+      if (row == 0 || column == 0 || row == size - 1 || column == size - 1) {
+        return;
+      }
+
+      uint32_t sum = 0;
+      for (size_t neighbour_row = row - 1; neighbour_row <= row + 1; ++neighbour_row) {
+        for (size_t neighbour_column = column - 1; neighbour_column <= column + 1; ++neighbour_column) {
+          sum += image(neighbour_row, neighbour_column);
+        }
+      }
+
+      pixel = sum / 9;
+    });
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size * size));
+}
+
+/// @brief state.range(0) is the width and height of the grids; a = b * k + c written as a loop over operator()
+void AxpyHandLoop(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+
+  Vector2D<float> a(size, size);
+  Vector2D<float> b(size, size, 1.0f);
+  Vector2D<float> c(size, size, 2.0f);
+
+  for (auto _ : state) {
+    for (size_t row = 0; row < size; ++row) {
+      for (size_t column = 0; column < size; ++column) {
+        a(row, column) = b(row, column) * 0.5f + c(row, column);
+      }
+    }
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * size * 3 * sizeof(float)));
+}
+
+/// @brief Same as AxpyHandLoop, as an expression
+void AxpyExpression(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+
+  Vector2D<float> a(size, size);
+  Vector2D<float> b(size, size, 1.0f);
+  Vector2D<float> c(size, size, 2.0f);
+
+  for (auto _ : state) {
+    a = b * 0.5f + c;
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * size * 3 * sizeof(float)));
+}
+
+void SumExpression(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+
+  Vector2D<float> a(size, size, 1.0f);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sum(a));
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * size * sizeof(float)));
+}
+
+/// @brief Same as AxpyExpression, state.range(1) threads each taking a block of rows they first touched
+void ParallelAxpy(benchmark::State& state) {
+  const auto size        = static_cast<size_t>(state.range(0));
+  const auto num_threads = static_cast<size_t>(state.range(1));
+
+  using helpers::containers::parallel_first_touch;
+
+  Vector2D<float> a(parallel_first_touch, size, size, 0.0f, num_threads);
+  Vector2D<float> b(parallel_first_touch, size, size, 1.0f, num_threads);
+  Vector2D<float> c(parallel_first_touch, size, size, 2.0f, num_threads);
+
+  for (auto _ : state) {
+    helpers::containers::parallel_transform(b * 0.5f + c, a, [](float value) { return value; }, num_threads);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * size * 3 * sizeof(float)));
+}
+
+void ParallelSum(benchmark::State& state) {
+  const auto size        = static_cast<size_t>(state.range(0));
+  const auto num_threads = static_cast<size_t>(state.range(1));
+
+  Vector2D<float> a(helpers::containers::parallel_first_touch, size, size, 1.0f, num_threads);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(helpers::containers::parallel_reduce(a, 0.0f, std::plus<>(), num_threads));
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * size * sizeof(float)));
+}
+
+void ImageSizes(benchmark::internal::Benchmark* p_benchmark) {
+  p_benchmark->ArgNames({"size"})->Arg(512)->Arg(2048)->Arg(4096);
+}
+
+void ImageSizesAndThreads(benchmark::internal::Benchmark* p_benchmark) {
+  p_benchmark->ArgNames({"size", "threads"})->ArgsProduct({{2048, 8192}, {1, 2, 4, 8}})->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(ColumnWalk, RowMajorLayout)->Apply(ImageSizes);
+BENCHMARK_TEMPLATE(ColumnWalk, TiledLayout<8, 8>)->Apply(ImageSizes);
+BENCHMARK_TEMPLATE(ColumnWalk, TiledLayout<64, 64>)->Apply(ImageSizes);
+
+BENCHMARK_TEMPLATE(Stencil, RowMajorLayout)->Apply(ImageSizes);
+BENCHMARK_TEMPLATE(Stencil, TiledLayout<8, 8>)->Apply(ImageSizes);
+BENCHMARK_TEMPLATE(Stencil, TiledLayout<64, 64>)->Apply(ImageSizes);
+
+BENCHMARK(AxpyHandLoop)->Apply(ImageSizes);
+BENCHMARK(AxpyExpression)->Apply(ImageSizes);
+BENCHMARK(SumExpression)->Apply(ImageSizes);
+
+BENCHMARK(ParallelAxpy)->Apply(ImageSizesAndThreads);
+BENCHMARK(ParallelSum)->Apply(ImageSizesAndThreads);
+
+BENCHMARK_MAIN();
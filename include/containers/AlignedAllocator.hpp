@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace helpers::containers {
+
+/// @brief Standard allocator whose allocations start on an _Alignment byte boundary, eg a cache line or a SIMD register
+/// @tparam _Tp type of the objects to allocate
+/// @tparam _Alignment alignment in bytes; a power of two, at least alignof(_Tp)
+template <typename _Tp, size_t _Alignment>
+class AlignedAllocator {
+ public:
+  using value_type = _Tp;
+  using size_type  = size_t;
+
+  using is_always_equal = std::true_type;
+
+  static_assert(_Alignment != 0 && (_Alignment & (_Alignment - 1)) == 0, "alignment must be a power of two");
+  static_assert(_Alignment >= alignof(_Tp));
+
+  template <typename _Up>
+  struct rebind {
+    using other = AlignedAllocator<_Up, _Alignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+
+  template <typename _Up>
+  AlignedAllocator(const AlignedAllocator<_Up, _Alignment>&) noexcept {}
+
+  _Tp* allocate(size_type num_objects) {
+    return static_cast<_Tp*>(::operator new(num_objects * sizeof(_Tp), std::align_val_t(_Alignment)));
+  }
+
+  void deallocate(_Tp* p, size_type) noexcept { ::operator delete(p, std::align_val_t(_Alignment)); }
+
+  template <typename _Up>
+  bool operator==(const AlignedAllocator<_Up, _Alignment>&) const noexcept {
+    return true;
+  }
+
+  template <typename _Up>
+  bool operator!=(const AlignedAllocator<_Up, _Alignment>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace helpers::containers
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace helpers::containers {
+
+/// @brief Growable pool of uninitialized slots for objects of type _Tp
+/// Slots are carved out of chunks of _SlotsPerChunk slots that never move, so pointers stay valid until the pool is
+/// destroyed. Released slots are kept on an intrusive free list and recycled first; memory is only returned to the
+/// heap when the pool is destroyed. Allocating only touches the heap when every chunk is in use.
+/// @tparam _Tp type of the objects stored in the pool
+/// @tparam _SlotsPerChunk number of slots added each time the pool grows
+template <typename _Tp, size_t _SlotsPerChunk = 64>
+class ChunkedPool {
+ public:
+  using value_type = _Tp;
+  using pointer    = value_type*;
+  using size_type  = size_t;
+
+  static_assert(_SlotsPerChunk != 0);
+
+  /// @brief Doesn't allocate; the first chunk is allocated by the first call to allocate() or reserve()
+  ChunkedPool() noexcept = default;
+
+  ChunkedPool(const ChunkedPool&) = delete;
+  ChunkedPool(ChunkedPool&&)      = delete;
+  ChunkedPool& operator=(const ChunkedPool&) = delete;
+  ChunkedPool& operator=(ChunkedPool&&) = delete;
+
+  /// @brief Frees every chunk; doesn't destroy objects that are still constructed in the pool
+  ~ChunkedPool() = default;
+
+  /// @return uninitialized storage for one _Tp
+  /// @throw std::bad_alloc if a new chunk is needed and can't be allocated
+  pointer allocate();
+
+  /// @param p pointer returned by allocate(), whose object (if any) has already been destroyed
+  void deallocate(pointer p) noexcept;
+
+  /// @brief Allocates a slot and constructs an object in it
+  template <typename... _Args>
+  pointer construct(_Args&&... args);
+
+  /// @brief Destroys an object created by construct() and releases its slot
+  void destroy(pointer p) noexcept;
+
+  /// @brief Allocates chunks up front, so that the pool holds num_slots objects without touching the heap again
+  void reserve(size_type num_slots);
+
+  bool empty() const noexcept;
+
+  /// @return number of slots in use
+  size_type size() const noexcept;
+
+  /// @return number of slots in every chunk allocated so far
+  size_type capacity() const noexcept;
+
+ private:
+  union Slot {
+    alignas(value_type) std::byte storage[sizeof(value_type)];
+
+    // only valid while the slot is released
+    Slot* p_next_slot;
+  };
+
+  struct Chunk {
+    std::array<Slot, _SlotsPerChunk> slots;
+  };
+
+  /// @brief Allocates a chunk without initializing its slots
+  void AddChunk();
+
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+
+  // head of the list of slots that were used and then released
+  Slot* p_next_available_slot_ = nullptr;
+
+  // slots at or above this position (counted across every chunk) have never been used
+  size_type high_water_mark_ = 0;
+
+  size_type num_slots_used_ = 0;
+};
+
+}  // namespace helpers::containers
+
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+
+namespace helpers::containers {
+
+template <typename _Tp, size_t _SlotsPerChunk>
+auto ChunkedPool<_Tp, _SlotsPerChunk>::allocate() -> pointer {
+  Slot* p_slot = p_next_available_slot_;
+
+  // recycled slots are preferred, they're more likely to still be in cache
+  if (p_slot != nullptr) {
+    p_next_available_slot_ = p_slot->p_next_slot;
+  } else {
+    if (high_water_mark_ == capacity()) {
+      AddChunk();
+    }
+
+    p_slot = &chunks_[high_water_mark_ / _SlotsPerChunk]->slots[high_water_mark_ % _SlotsPerChunk];
+    ++high_water_mark_;
+  }
+
+  ++num_slots_used_;
+  return reinterpret_cast<pointer>(p_slot->storage);
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+void ChunkedPool<_Tp, _SlotsPerChunk>::deallocate(pointer p) noexcept {
+  auto* p_slot = reinterpret_cast<Slot*>(p);
+
+  p_slot->p_next_slot    = p_next_available_slot_;
+  p_next_available_slot_ = p_slot;
+
+  --num_slots_used_;
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+template <typename... _Args>
+auto ChunkedPool<_Tp, _SlotsPerChunk>::construct(_Args&&... args) -> pointer {
+  auto* p_storage = allocate();
+
+  try {
+    return ::new (static_cast<void*>(p_storage)) value_type(std::forward<_Args>(args)...);
+  } catch (...) {
+    deallocate(p_storage);
+    throw;
+  }
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+void ChunkedPool<_Tp, _SlotsPerChunk>::destroy(pointer p) noexcept {
+  p->~value_type();
+  deallocate(p);
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+void ChunkedPool<_Tp, _SlotsPerChunk>::reserve(size_type num_slots) {
+  while (capacity() < num_slots) {
+    AddChunk();
+  }
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+bool ChunkedPool<_Tp, _SlotsPerChunk>::empty() const noexcept {
+  return num_slots_used_ == 0;
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+auto ChunkedPool<_Tp, _SlotsPerChunk>::size() const noexcept -> size_type {
+  return num_slots_used_;
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+auto ChunkedPool<_Tp, _SlotsPerChunk>::capacity() const noexcept -> size_type {
+  return chunks_.size() * _SlotsPerChunk;
+}
+
+template <typename _Tp, size_t _SlotsPerChunk>
+void ChunkedPool<_Tp, _SlotsPerChunk>::AddChunk() {
+  // default initialization leaves the slots untouched
+  chunks_.push_back(std::unique_ptr<Chunk>(new Chunk));
+}
+
+}  // namespace helpers::containers
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @brief Lock-free (Treiber) stack of node indices, linked through an array of next indices
+/// The head packs the index of the top node with a tag that changes on every update, into a single 64 bit word. A pop
+/// that raced with other pops and pushes of the same node therefore fails its compare and swap even if the same index
+/// is back on top (the ABA problem), so no hazard pointers or epochs are needed. Nodes are never freed, only recycled,
+/// so reading the next index of a node that was popped concurrently is harmless.
+/// @tparam _N number of nodes; index _N means "no node"
+template <size_t _N>
+class TaggedIndexStack {
+ public:
+  using size_type = size_t;
+
+  static_assert(_N < std::numeric_limits<uint32_t>::max(), "node indices must fit in 32 bits");
+  static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+  static constexpr size_type kNullIdx = _N;
+
+  TaggedIndexStack() noexcept : head_(Pack(kNullIdx, 0)) {}
+
+  void Push(size_type node_idx) noexcept {
+    auto head = head_.load(std::memory_order_relaxed);
+
+    do {
+      next_node_idxs_[node_idx].store(Index(head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, Pack(node_idx, Tag(head) + 1), std::memory_order_release,
+                                          std::memory_order_relaxed));
+  }
+
+  /// @return index of the node that was on top, or kNullIdx if the stack was empty
+  size_type Pop() noexcept {
+    auto head = head_.load(std::memory_order_acquire);
+
+    while (Index(head) != kNullIdx) {
+      // may read the link of a node that another thread just popped; the tag makes the exchange fail in that case
+      const auto next_node_idx = next_node_idxs_[Index(head)].load(std::memory_order_relaxed);
+
+      if (head_.compare_exchange_weak(head, Pack(next_node_idx, Tag(head) + 1), std::memory_order_acquire,
+                                      std::memory_order_acquire)) {
+        return Index(head);
+      }
+    }
+
+    return kNullIdx;
+  }
+
+ private:
+  static uint64_t Pack(size_type node_idx, uint32_t tag) noexcept {
+    return (uint64_t{tag} << 32) | static_cast<uint32_t>(node_idx);
+  }
+
+  static uint32_t Index(uint64_t head) noexcept { return static_cast<uint32_t>(head); }
+
+  static uint32_t Tag(uint64_t head) noexcept { return static_cast<uint32_t>(head >> 32); }
+
+  // on its own cache line, so pushes and pops don't contend with readers of the links
+  alignas(64) std::atomic<uint64_t> head_;
+
+  std::array<std::atomic<uint32_t>, _N> next_node_idxs_;
+};
+
+}  // namespace detail
+
+/// @brief Lock-free allocator of slot indices in [0, _N), eg for a shared array of message buffers
+/// Any thread may allocate or deallocate. Slots are handed out from a high water mark until every slot has been used
+/// once, and from a lock-free stack of released slots after that.
+/// @tparam _N number of slots
+template <size_t _N>
+class ConcurrentFreeList {
+ public:
+  using size_type = size_t;
+
+  /// Returned by allocate() when every slot is in use
+  static constexpr size_type npos = _N;
+
+  ConcurrentFreeList() noexcept = default;
+
+  ConcurrentFreeList(const ConcurrentFreeList&) = delete;
+  ConcurrentFreeList(ConcurrentFreeList&&)      = delete;
+  ConcurrentFreeList& operator=(const ConcurrentFreeList&) = delete;
+  ConcurrentFreeList& operator=(ConcurrentFreeList&&) = delete;
+
+  ~ConcurrentFreeList() = default;
+
+  /// @return index of a slot that the caller now owns, or npos if every slot is in use
+  size_type allocate() noexcept;
+
+  /// @param slot_idx index returned by allocate(); the caller gives up ownership of the slot
+  void deallocate(size_type slot_idx) noexcept;
+
+  size_type capacity() const noexcept;
+
+ private:
+  detail::TaggedIndexStack<_N> released_slots_;
+
+  // slots at or above this index have never been allocated
+  alignas(64) std::atomic<size_type> high_water_mark_{0};
+};
+
+/// @brief Thread safe, lock-free variant of FastLinkedList that only supports stack operations
+/// Elements and free nodes are kept on two tagged index stacks over the same fixed array of nodes, so neither
+/// push_front nor pop_front ever blocks or allocates. An element is only accessed by the thread that owns its node,
+/// between taking the node from one stack and putting it on the other.
+/// @tparam _Tp value type
+/// @tparam _N maximum number of elements
+template <typename _Tp, size_t _N>
+class ConcurrentFastLinkedList {
+ public:
+  using value_type = _Tp;
+  using size_type  = size_t;
+
+  ConcurrentFastLinkedList() noexcept = default;
+
+  ConcurrentFastLinkedList(const ConcurrentFastLinkedList&) = delete;
+  ConcurrentFastLinkedList(ConcurrentFastLinkedList&&)      = delete;
+  ConcurrentFastLinkedList& operator=(const ConcurrentFastLinkedList&) = delete;
+  ConcurrentFastLinkedList& operator=(ConcurrentFastLinkedList&&) = delete;
+
+  /// @brief Must not run concurrently with any other member function
+  ~ConcurrentFastLinkedList();
+
+  /// @return false if the list is full, in which case nothing is inserted
+  bool push_front(const _Tp& value);
+
+  bool push_front(_Tp&& value);
+
+  template <typename... _Args>
+  bool emplace_front(_Args&&... args);
+
+  /// @brief Moves the front element into value and removes it
+  /// @return false if the list is empty, in which case value isn't modified
+  bool pop_front(_Tp& value);
+
+  /// @brief Only a snapshot while other threads are pushing or popping
+  size_type size() const noexcept;
+
+  bool empty() const noexcept;
+
+  size_type max_size() const noexcept;
+
+ private:
+  struct ValueStorage {
+    alignas(value_type) std::byte bytes[sizeof(value_type)];
+  };
+
+  value_type& Value(size_type node_idx) noexcept;
+
+  ConcurrentFreeList<_N> free_nodes_;
+
+  detail::TaggedIndexStack<_N> elements_;
+
+  std::array<ValueStorage, _N> values_;
+
+  alignas(64) std::atomic<size_type> num_elements_{0};
+};
+
+}  // namespace helpers::containers
+
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+
+namespace helpers::containers {
+
+template <size_t _N>
+auto ConcurrentFreeList<_N>::allocate() noexcept -> size_type {
+  const auto slot_idx = released_slots_.Pop();
+  if (slot_idx != detail::TaggedIndexStack<_N>::kNullIdx) {
+    return slot_idx;
+  }
+
+  // never go past _N, so that the high water mark can't overflow however many threads try
+  auto high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+  while (high_water_mark < _N) {
+    if (high_water_mark_.compare_exchange_weak(high_water_mark, high_water_mark + 1, std::memory_order_relaxed)) {
+      return high_water_mark;
+    }
+  }
+
+  return npos;
+}
+
+template <size_t _N>
+void ConcurrentFreeList<_N>::deallocate(size_type slot_idx) noexcept {
+  released_slots_.Push(slot_idx);
+}
+
+template <size_t _N>
+auto ConcurrentFreeList<_N>::capacity() const noexcept -> size_type {
+  return _N;
+}
+
+template <typename _Tp, size_t _N>
+ConcurrentFastLinkedList<_Tp, _N>::~ConcurrentFastLinkedList() {
+  for (auto node_idx = elements_.Pop(); node_idx != detail::TaggedIndexStack<_N>::kNullIdx;
+       node_idx      = elements_.Pop()) {
+    Value(node_idx).~value_type();
+  }
+}
+
+template <typename _Tp, size_t _N>
+bool ConcurrentFastLinkedList<_Tp, _N>::push_front(const _Tp& value) {
+  return emplace_front(value);
+}
+
+template <typename _Tp, size_t _N>
+bool ConcurrentFastLinkedList<_Tp, _N>::push_front(_Tp&& value) {
+  return emplace_front(std::move(value));
+}
+
+template <typename _Tp, size_t _N>
+template <typename... _Args>
+bool ConcurrentFastLinkedList<_Tp, _N>::emplace_front(_Args&&... args) {
+  const auto node_idx = free_nodes_.allocate();
+  if (node_idx == ConcurrentFreeList<_N>::npos) {
+    return false;
+  }
+
+  // the node is owned by this thread until it's pushed
+  try {
+    ::new (static_cast<void*>(values_[node_idx].bytes)) value_type(std::forward<_Args>(args)...);
+  } catch (...) {
+    free_nodes_.deallocate(node_idx);
+    throw;
+  }
+
+  num_elements_.fetch_add(1, std::memory_order_relaxed);
+  elements_.Push(node_idx);
+  return true;
+}
+
+template <typename _Tp, size_t _N>
+bool ConcurrentFastLinkedList<_Tp, _N>::pop_front(_Tp& value) {
+  const auto node_idx = elements_.Pop();
+  if (node_idx == detail::TaggedIndexStack<_N>::kNullIdx) {
+    return false;
+  }
+
+  num_elements_.fetch_sub(1, std::memory_order_relaxed);
+
+  // the node is owned by this thread until it's released; if the move throws, the element is dropped anyway
+  struct ReleaseNode {
+    ~ReleaseNode() {
+      p_list->Value(node_idx).~value_type();
+      p_list->free_nodes_.deallocate(node_idx);
+    }
+
+    ConcurrentFastLinkedList* p_list;
+    size_type                 node_idx;
+  } release_node{this, node_idx};
+
+  value = std::move(Value(node_idx));
+  return true;
+}
+
+template <typename _Tp, size_t _N>
+auto ConcurrentFastLinkedList<_Tp, _N>::size() const noexcept -> size_type {
+  return num_elements_.load(std::memory_order_relaxed);
+}
+
+template <typename _Tp, size_t _N>
+bool ConcurrentFastLinkedList<_Tp, _N>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename _Tp, size_t _N>
+auto ConcurrentFastLinkedList<_Tp, _N>::max_size() const noexcept -> size_type {
+  return _N;
+}
+
+template <typename _Tp, size_t _N>
+auto ConcurrentFastLinkedList<_Tp, _N>::Value(size_type node_idx) noexcept -> value_type& {
+  return *std::launder(reinterpret_cast<value_type*>(values_[node_idx].bytes));
+}
+
+}  // namespace helpers::containers
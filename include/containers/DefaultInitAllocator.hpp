@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace helpers::containers {
+
+/// @brief Allocator adaptor that default-initializes instead of value-initializing
+/// std::vector<int, DefaultInitAllocator<std::allocator<int>>>(n) then leaves the ints uninitialized, so a large
+/// allocation isn't written (and its pages aren't touched) until the caller fills it, eg from several threads.
+/// Construction with arguments is forwarded to _Alloc. Class types with a non-trivial default constructor run it, but
+/// their trivial members are left indeterminate too, eg the int of struct { std::string name; int count; }.
+/// @tparam _Alloc allocator to adapt
+template <typename _Alloc>
+class DefaultInitAllocator : public _Alloc {
+ public:
+  using allocator_traits = std::allocator_traits<_Alloc>;
+
+  template <typename _Up>
+  struct rebind {
+    using other = DefaultInitAllocator<typename allocator_traits::template rebind_alloc<_Up>>;
+  };
+
+  using _Alloc::_Alloc;
+
+  DefaultInitAllocator() = default;
+
+  template <typename _OtherAlloc>
+  DefaultInitAllocator(const DefaultInitAllocator<_OtherAlloc>& other) noexcept
+    : _Alloc(static_cast<const _OtherAlloc&>(other)) {}
+
+  template <typename _Up>
+  void construct(_Up* p) noexcept(std::is_nothrow_default_constructible<_Up>::value) {
+    ::new (static_cast<void*>(p)) _Up;
+  }
+
+  template <typename _Up, typename... _Args>
+  void construct(_Up* p, _Args&&... args) {
+    allocator_traits::construct(static_cast<_Alloc&>(*this), p, std::forward<_Args>(args)...);
+  }
+};
+
+}  // namespace helpers::containers
@@ -0,0 +1,589 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "FastLinkedList.hpp"
+
+namespace helpers::containers {
+
+/// @brief Circular doubly linked list with a fixed capacity of _N nodes and no dynamic allocation
+/// Inserting returns a Handle to the new element, which allows erasing or moving that element in O(1). A handle
+/// carries the generation of its node, which changes whenever the element is erased, so stale handles are detected
+/// with a single comparison instead of silently referring to whatever element reused the node.
+/// @tparam _Tp value type
+/// @tparam _N maximum number of elements
+template <typename _Tp, size_t _N>
+class FastDoublyLinkedList {
+ public:
+  using value_type      = _Tp;
+  using reference       = value_type&;
+  using const_reference = const value_type&;
+  using size_type       = size_t;
+  using index_type      = detail::FastLinkedListIndex<_N>;
+
+  /// @brief Refers to one element until that element is erased; a default constructed handle is null
+  struct Handle {
+    index_type node_idx   = _N;
+    uint32_t   generation = 0;
+
+    explicit operator bool() const noexcept { return node_idx != _N; }
+
+    friend bool operator==(const Handle& lhs, const Handle& rhs) noexcept {
+      return lhs.node_idx == rhs.node_idx && lhs.generation == rhs.generation;
+    }
+
+    friend bool operator!=(const Handle& lhs, const Handle& rhs) noexcept { return !(lhs == rhs); }
+  };
+
+  template <bool b_const>
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = FastDoublyLinkedList::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<b_const, const value_type*, value_type*>;
+    using reference         = std::conditional_t<b_const, const value_type&, value_type&>;
+
+    Iterator() noexcept = default;
+
+    /// @brief iterator converts to const_iterator
+    template <bool b_other_const, typename = std::enable_if_t<b_const && !b_other_const>>
+    Iterator(const Iterator<b_other_const>& other) noexcept;
+
+    reference operator*() const;
+    pointer   operator->() const;
+
+    Iterator& operator++();
+    Iterator  operator++(int);
+    Iterator& operator--();
+    Iterator  operator--(int);
+
+    /// @return handle to the element the iterator refers to
+    Handle handle() const noexcept;
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.p_list_ == rhs.p_list_ && lhs.node_idx_ == rhs.node_idx_;
+    }
+
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept { return !(lhs == rhs); }
+
+   private:
+    friend class FastDoublyLinkedList;
+
+    template <bool b_other_const>
+    friend class Iterator;
+
+    using list_pointer = std::conditional_t<b_const, const FastDoublyLinkedList*, FastDoublyLinkedList*>;
+
+    Iterator(list_pointer p_list, size_type node_idx) noexcept;
+
+    list_pointer p_list_   = nullptr;
+    size_type    node_idx_ = 0;
+  };
+
+  using iterator       = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FastDoublyLinkedList();
+
+  FastDoublyLinkedList(const FastDoublyLinkedList&) = delete;
+  FastDoublyLinkedList(FastDoublyLinkedList&&)      = delete;
+  FastDoublyLinkedList& operator=(const FastDoublyLinkedList&) = delete;
+  FastDoublyLinkedList& operator=(FastDoublyLinkedList&&) = delete;
+
+  ~FastDoublyLinkedList();
+
+  /// @throw std::out_of_range if the list is empty
+  reference       front();
+  const_reference front() const;
+  reference       back();
+  const_reference back() const;
+
+  /// @throw std::out_of_range if handle is null or stale
+  reference       at(Handle handle);
+  const_reference at(Handle handle) const;
+
+  /// @return true if handle refers to an element of the list
+  bool contains(Handle handle) const noexcept;
+
+  iterator       begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+
+  iterator       end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+
+  bool full() const noexcept;
+
+  size_type size() const noexcept;
+
+  size_type max_size() const noexcept;
+
+  /// @brief Destroys every element and invalidates every handle; O(size())
+  void clear() noexcept;
+
+  /// @return handle to the new element, or a null handle if the list is full, in which case nothing is inserted
+  Handle push_front(const _Tp& value);
+  Handle push_front(_Tp&& value);
+  Handle push_back(const _Tp& value);
+  Handle push_back(_Tp&& value);
+
+  template <typename... _Args>
+  Handle emplace_front(_Args&&... args);
+
+  template <typename... _Args>
+  Handle emplace_back(_Args&&... args);
+
+  void pop_front();
+
+  void pop_back();
+
+  /// @return false if handle is null or stale, in which case nothing is erased
+  bool erase(Handle handle);
+
+  /// @brief Moves the element to the front without touching its value; its handle stays valid
+  /// @return false if handle is null or stale
+  bool move_to_front(Handle handle) noexcept;
+
+  /// @brief Moves the element to the back without touching its value; its handle stays valid
+  /// @return false if handle is null or stale
+  bool move_to_back(Handle handle) noexcept;
+
+ private:
+  struct Node {
+    // holds a value_type only while the node is part of the list
+    alignas(value_type) std::byte storage[sizeof(value_type)];
+    index_type prev_node_idx;
+    index_type next_node_idx;
+
+    // changes every time the node's element is erased
+    uint32_t generation;
+  };
+
+  reference       Value(size_type node_idx);
+  const_reference Value(size_type node_idx) const;
+
+  /// @brief Constructs a new element and links it in front of next_node_idx
+  template <typename... _Args>
+  Handle EmplaceBefore(size_type next_node_idx, _Args&&... args);
+
+  void Unlink(size_type node_idx) noexcept;
+
+  void LinkBefore(size_type node_idx, size_type next_node_idx) noexcept;
+
+  /// @brief Takes a node from the recycled nodes list, or from the high water mark if that list is empty
+  size_type AllocateNode() noexcept;
+
+  /// @brief Destroys the value in node_idx, which must already be unlinked, and recycles the node
+  void ReturnToAvailableNodesList(size_type node_idx) noexcept;
+
+  // nodes_[_N] is the sentinel; its next node is the front of the list and its previous node is the back
+  std::array<Node, _N + 1> nodes_;
+
+  // head of the list of nodes that were used and then released (linked through next_node_idx); _N when there are none
+  index_type next_available_node_idx_;
+
+  // nodes at or above this index are unused since construction or the last clear()
+  size_type high_water_mark_;
+
+  // nodes at or above this index have never been used, so their generation hasn't been initialized
+  size_type initialized_nodes_;
+
+  size_type num_nodes_;
+
+  static constexpr size_type kSentinelIdx = _N;
+};
+
+}  // namespace helpers::containers
+
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+
+namespace helpers::containers {
+
+template <typename _Tp, size_t _N>
+FastDoublyLinkedList<_Tp, _N>::FastDoublyLinkedList()
+    : next_available_node_idx_(_N), high_water_mark_(0), initialized_nodes_(0), num_nodes_(0) {
+  static_assert(_N != 0);
+
+  nodes_[kSentinelIdx].prev_node_idx = kSentinelIdx;
+  nodes_[kSentinelIdx].next_node_idx = kSentinelIdx;
+
+  // end().handle() reads it; the sentinel is never released, so it stays at 0
+  nodes_[kSentinelIdx].generation = 0;
+}
+
+template <typename _Tp, size_t _N>
+FastDoublyLinkedList<_Tp, _N>::~FastDoublyLinkedList() {
+  clear();
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::front() -> reference {
+  if (empty()) {
+    throw std::out_of_range("");
+  }
+
+  return Value(nodes_[kSentinelIdx].next_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::front() const -> const_reference {
+  if (empty()) {
+    throw std::out_of_range("");
+  }
+
+  return Value(nodes_[kSentinelIdx].next_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::back() -> reference {
+  if (empty()) {
+    throw std::out_of_range("");
+  }
+
+  return Value(nodes_[kSentinelIdx].prev_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::back() const -> const_reference {
+  if (empty()) {
+    throw std::out_of_range("");
+  }
+
+  return Value(nodes_[kSentinelIdx].prev_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::at(Handle handle) -> reference {
+  if (!contains(handle)) {
+    throw std::out_of_range("");
+  }
+
+  return Value(handle.node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::at(Handle handle) const -> const_reference {
+  if (!contains(handle)) {
+    throw std::out_of_range("");
+  }
+
+  return Value(handle.node_idx);
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::contains(Handle handle) const noexcept {
+  // released nodes below the high water mark have already moved on to a new generation
+  return handle.node_idx < high_water_mark_ && nodes_[handle.node_idx].generation == handle.generation;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::begin() noexcept -> iterator {
+  return iterator(this, nodes_[kSentinelIdx].next_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::begin() const noexcept -> const_iterator {
+  return const_iterator(this, nodes_[kSentinelIdx].next_node_idx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::cbegin() const noexcept -> const_iterator {
+  return begin();
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::end() noexcept -> iterator {
+  return iterator(this, kSentinelIdx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::end() const noexcept -> const_iterator {
+  return const_iterator(this, kSentinelIdx);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::cend() const noexcept -> const_iterator {
+  return end();
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::empty() const noexcept {
+  return num_nodes_ == 0;
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::full() const noexcept {
+  return num_nodes_ == _N;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::size() const noexcept -> size_type {
+  return num_nodes_;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::max_size() const noexcept -> size_type {
+  return _N;
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::clear() noexcept {
+  // every element must get a new generation, even if _Tp is trivially destructible, so that its handles go stale
+  for (size_type node_idx = nodes_[kSentinelIdx].next_node_idx; node_idx != kSentinelIdx;) {
+    const auto next_node_idx = nodes_[node_idx].next_node_idx;
+    Value(node_idx).~value_type();
+    ++nodes_[node_idx].generation;
+    node_idx = next_node_idx;
+  }
+
+  nodes_[kSentinelIdx].prev_node_idx = kSentinelIdx;
+  nodes_[kSentinelIdx].next_node_idx = kSentinelIdx;
+
+  next_available_node_idx_ = _N;
+  high_water_mark_         = 0;
+  num_nodes_               = 0;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::push_front(const _Tp& value) -> Handle {
+  return emplace_front(value);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::push_front(_Tp&& value) -> Handle {
+  return emplace_front(std::move(value));
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::push_back(const _Tp& value) -> Handle {
+  return emplace_back(value);
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::push_back(_Tp&& value) -> Handle {
+  return emplace_back(std::move(value));
+}
+
+template <typename _Tp, size_t _N>
+template <typename... _Args>
+auto FastDoublyLinkedList<_Tp, _N>::emplace_front(_Args&&... args) -> Handle {
+  return EmplaceBefore(nodes_[kSentinelIdx].next_node_idx, std::forward<_Args>(args)...);
+}
+
+template <typename _Tp, size_t _N>
+template <typename... _Args>
+auto FastDoublyLinkedList<_Tp, _N>::emplace_back(_Args&&... args) -> Handle {
+  return EmplaceBefore(kSentinelIdx, std::forward<_Args>(args)...);
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::pop_front() {
+  if (!empty()) {
+    const size_type node_idx = nodes_[kSentinelIdx].next_node_idx;
+
+    Unlink(node_idx);
+    ReturnToAvailableNodesList(node_idx);
+  }
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::pop_back() {
+  if (!empty()) {
+    const size_type node_idx = nodes_[kSentinelIdx].prev_node_idx;
+
+    Unlink(node_idx);
+    ReturnToAvailableNodesList(node_idx);
+  }
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::erase(Handle handle) {
+  if (!contains(handle)) {
+    return false;
+  }
+
+  Unlink(handle.node_idx);
+  ReturnToAvailableNodesList(handle.node_idx);
+  return true;
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::move_to_front(Handle handle) noexcept {
+  if (!contains(handle)) {
+    return false;
+  }
+
+  Unlink(handle.node_idx);
+  LinkBefore(handle.node_idx, nodes_[kSentinelIdx].next_node_idx);
+  return true;
+}
+
+template <typename _Tp, size_t _N>
+bool FastDoublyLinkedList<_Tp, _N>::move_to_back(Handle handle) noexcept {
+  if (!contains(handle)) {
+    return false;
+  }
+
+  Unlink(handle.node_idx);
+  LinkBefore(handle.node_idx, kSentinelIdx);
+  return true;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::Value(size_type node_idx) -> reference {
+  return *std::launder(reinterpret_cast<value_type*>(nodes_[node_idx].storage));
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::Value(size_type node_idx) const -> const_reference {
+  return *std::launder(reinterpret_cast<const value_type*>(nodes_[node_idx].storage));
+}
+
+template <typename _Tp, size_t _N>
+template <typename... _Args>
+auto FastDoublyLinkedList<_Tp, _N>::EmplaceBefore(size_type next_node_idx, _Args&&... args) -> Handle {
+  if (full()) {
+    return Handle{};
+  }
+
+  const auto new_node_idx = AllocateNode();
+
+  // construct the value; if that throws, the node goes back to the recycled nodes list
+  try {
+    ::new (static_cast<void*>(nodes_[new_node_idx].storage)) value_type(std::forward<_Args>(args)...);
+  } catch (...) {
+    nodes_[new_node_idx].next_node_idx = next_available_node_idx_;
+    next_available_node_idx_           = new_node_idx;
+    throw;
+  }
+
+  LinkBefore(new_node_idx, next_node_idx);
+  ++num_nodes_;
+
+  const index_type handle_node_idx = new_node_idx;
+  return Handle{handle_node_idx, nodes_[new_node_idx].generation};
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::Unlink(size_type node_idx) noexcept {
+  auto& node = nodes_[node_idx];
+
+  nodes_[node.prev_node_idx].next_node_idx = node.next_node_idx;
+  nodes_[node.next_node_idx].prev_node_idx = node.prev_node_idx;
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::LinkBefore(size_type node_idx, size_type next_node_idx) noexcept {
+  auto&      node          = nodes_[node_idx];
+  const auto prev_node_idx = nodes_[next_node_idx].prev_node_idx;
+
+  node.prev_node_idx                  = prev_node_idx;
+  node.next_node_idx                  = next_node_idx;
+  nodes_[prev_node_idx].next_node_idx = node_idx;
+  nodes_[next_node_idx].prev_node_idx = node_idx;
+}
+
+template <typename _Tp, size_t _N>
+auto FastDoublyLinkedList<_Tp, _N>::AllocateNode() noexcept -> size_type {
+  // recycled nodes are preferred, they're more likely to still be in cache
+  if (next_available_node_idx_ != kSentinelIdx) {
+    const size_type node_idx = next_available_node_idx_;
+    next_available_node_idx_ = nodes_[node_idx].next_node_idx;
+    return node_idx;
+  }
+
+  // generations are initialized on first use, and then kept across clear() so that old handles stay stale
+  if (high_water_mark_ == initialized_nodes_) {
+    nodes_[initialized_nodes_++].generation = 0;
+  }
+
+  return high_water_mark_++;
+}
+
+template <typename _Tp, size_t _N>
+void FastDoublyLinkedList<_Tp, _N>::ReturnToAvailableNodesList(size_type node_idx) noexcept {
+  auto& node = nodes_[node_idx];
+
+  Value(node_idx).~value_type();
+  ++node.generation;
+
+  node.next_node_idx       = next_available_node_idx_;
+  next_available_node_idx_ = node_idx;
+
+  --num_nodes_;
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+template <bool b_other_const, typename>
+FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::Iterator(const Iterator<b_other_const>& other) noexcept
+    : p_list_(other.p_list_), node_idx_(other.node_idx_) {}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::Iterator(list_pointer p_list, size_type node_idx) noexcept
+    : p_list_(p_list), node_idx_(node_idx) {}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator*() const -> reference {
+  return p_list_->Value(node_idx_);
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator->() const -> pointer {
+  return &p_list_->Value(node_idx_);
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator++() -> Iterator& {
+  node_idx_ = p_list_->nodes_[node_idx_].next_node_idx;
+  return *this;
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator++(int) -> Iterator {
+  auto iter = *this;
+  ++(*this);
+  return iter;
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator--() -> Iterator& {
+  node_idx_ = p_list_->nodes_[node_idx_].prev_node_idx;
+  return *this;
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::operator--(int) -> Iterator {
+  auto iter = *this;
+  --(*this);
+  return iter;
+}
+
+template <typename _Tp, size_t _N>
+template <bool b_const>
+auto FastDoublyLinkedList<_Tp, _N>::Iterator<b_const>::handle() const noexcept -> Handle {
+  const index_type handle_node_idx = node_idx_;
+  return Handle{handle_node_idx, p_list_->nodes_[node_idx_].generation};
+}
+
+}  // namespace helpers::containers
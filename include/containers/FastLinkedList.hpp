@@ -2,26 +2,136 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <forward_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace helpers::containers {
 
-template <typename _Tp, size_t _N>
+namespace detail {
+
+/// @brief Smallest unsigned integer type that can hold every node index of a list with _N nodes, plus the _N sentinel
+template <size_t _N>
+using FastLinkedListIndex = std::conditional_t<
+    _N <= std::numeric_limits<uint8_t>::max(), uint8_t,
+    std::conditional_t<_N <= std::numeric_limits<uint16_t>::max(), uint16_t,
+                       std::conditional_t<_N <= std::numeric_limits<uint32_t>::max(), uint32_t, size_t>>>;
+
+/// @brief Node of a FastLinkedList array; bounds checked, unless HELPERS_UNCHECKED_ACCESS is defined
+/// Without the check, front() on an empty list and dereferencing end() are undefined instead of throwing
+/// std::out_of_range
+template <typename _Array>
+auto& FastLinkedListNodeAt(_Array& nodes, size_t node_idx) {
+#ifdef HELPERS_UNCHECKED_ACCESS
+  return nodes[node_idx];
+#else
+  return nodes.at(node_idx);
+#endif
+}
+
+}  // namespace detail
+
+/// @brief Singly linked list with a fixed capacity of _N nodes and no dynamic allocation
+/// Nodes link to each other by index; the index type is the smallest one that fits _N, so small lists have small nodes.
+/// Iterators hold a node index, so they stay valid until the element they refer to is erased.
+/// @tparam _Tp value type
+/// @tparam _N maximum number of elements
+/// @tparam b_struct_of_arrays if true, values and links are stored in two separate arrays; a search that only follows
+/// links then touches fewer cache lines, and small values aren't padded to the alignment of the link
+template <typename _Tp, size_t _N, bool b_struct_of_arrays = false>
 class FastLinkedList {
  public:
   using value_type      = _Tp;
   using reference       = value_type&;
   using const_reference = const value_type&;
   using size_type       = size_t;
+  using index_type      = detail::FastLinkedListIndex<_N>;
+
+  template <bool b_const>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = FastLinkedList::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<b_const, const value_type*, value_type*>;
+    using reference         = std::conditional_t<b_const, const value_type&, value_type&>;
+
+    Iterator() noexcept = default;
+
+    /// @brief iterator converts to const_iterator
+    template <bool b_other_const, typename = std::enable_if_t<b_const && !b_other_const>>
+    Iterator(const Iterator<b_other_const>& other) noexcept;
+
+    reference operator*() const;
+    pointer   operator->() const;
+
+    Iterator& operator++();
+    Iterator  operator++(int);
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.p_list_ == rhs.p_list_ && lhs.node_idx_ == rhs.node_idx_;
+    }
+
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept { return !(lhs == rhs); }
+
+   private:
+    friend class FastLinkedList;
 
+    template <bool b_other_const>
+    friend class Iterator;
+
+    using list_pointer = std::conditional_t<b_const, const FastLinkedList*, FastLinkedList*>;
+
+    Iterator(list_pointer p_list, size_type node_idx) noexcept;
+
+    list_pointer p_list_   = nullptr;
+    size_type    node_idx_ = 0;
+  };
+
+  using iterator       = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  /// @brief Doesn't construct any values; nodes are handed out lazily, in order, as the list grows
   FastLinkedList();
 
+  /// @brief Same as FastLinkedList(); unused nodes hold no value, so they don't need a default value
   explicit FastLinkedList(const _Tp& default_value);
 
+  /// @brief Copies keep every element at the same node index as in other
+  FastLinkedList(const FastLinkedList& other);
+
+  /// @brief Moves every element into the same node index; other is left empty
+  FastLinkedList(FastLinkedList&& other) noexcept(std::is_nothrow_move_constructible<_Tp>::value);
+
+  FastLinkedList& operator=(const FastLinkedList& other);
+
+  FastLinkedList& operator=(FastLinkedList&& other) noexcept(std::is_nothrow_move_constructible<_Tp>::value);
+
+  ~FastLinkedList();
+
   reference front();
 
   const_reference front() const;
 
+  /// @brief Iterator to the position before the first element; only valid for insert_after, erase_after and
+  /// splice_after, or to increment
+  iterator       before_begin() noexcept;
+  const_iterator before_begin() const noexcept;
+  const_iterator cbefore_begin() const noexcept;
+
+  iterator       begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+
+  iterator       end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
   bool empty() const noexcept;
 
   bool full() const noexcept;
@@ -30,38 +140,149 @@ class FastLinkedList {
 
   size_type max_size() const noexcept;
 
+  /// @brief Destroys every element; O(1) if _Tp is trivially destructible, O(size()) otherwise
   void clear() noexcept;
 
+  /// @brief Same as clear()
   void clear(const _Tp& default_value) noexcept;
 
   void push_front(const _Tp& value);
 
   void push_front(_Tp&& value);
 
+  /// @brief Constructs a new element in place at the front of the list; does nothing if the list is full
+  template <typename... _Args>
+  void emplace_front(_Args&&... args);
+
   void pop_front();
 
+  /// @brief Inserts value after pos
+  /// @return iterator to the new element, or end() if the list is full, in which case nothing is inserted
+  iterator insert_after(const_iterator pos, const _Tp& value);
+
+  iterator insert_after(const_iterator pos, _Tp&& value);
+
+  /// @brief Constructs a new element in place after pos
+  /// @return iterator to the new element, or end() if the list is full, in which case nothing is constructed
+  template <typename... _Args>
+  iterator emplace_after(const_iterator pos, _Args&&... args);
+
+  /// @brief Erases the element after pos, which must exist
+  /// @return iterator to the element that followed the erased one
+  iterator erase_after(const_iterator pos);
+
+  /// @brief Erases the elements in (first, last)
+  /// @return last
+  iterator erase_after(const_iterator first, const_iterator last);
+
   void remove(const _Tp& value);
 
+  /// @brief Erases every element for which pred returns true
+  template <typename _Pred>
+  void remove_if(_Pred pred);
+
+  /// @brief Moves every element of other after pos, leaving other empty
+  /// Within one list the nodes are relinked; between two lists each element is move constructed into a node of this
+  /// list, since the lists don't share storage. Never allocates.
+  /// @throw std::length_error if the elements don't fit, in which case neither list is modified
+  void splice_after(const_iterator pos, FastLinkedList& other);
+
+  /// @brief Moves the element after it, which belongs to other, after pos
+  void splice_after(const_iterator pos, FastLinkedList& other, const_iterator it);
+
+  /// @brief Moves the elements of other in (first, last) after pos; pos must not be in (first, last)
+  void splice_after(const_iterator pos, FastLinkedList& other, const_iterator first, const_iterator last);
+
  private:
-  struct Node {
-    value_type value;
-    size_type  next_node_idx = _N;
+  /// @brief Raw storage for one value; holds a value_type only while its node is part of the list
+  struct ValueStorage {
+    alignas(value_type) std::byte bytes[sizeof(value_type)];
+  };
+
+  /// @brief Nodes stored as a single array of {value, link} pairs
+  struct ArrayOfStructs {
+    struct Node {
+      ValueStorage storage;
+      index_type   next_node_idx;
+    };
+
+    ValueStorage& storage(size_type node_idx) { return detail::FastLinkedListNodeAt(nodes, node_idx).storage; }
+    const ValueStorage& storage(size_type node_idx) const {
+      return detail::FastLinkedListNodeAt(nodes, node_idx).storage;
+    }
+
+    index_type& next(size_type node_idx) { return detail::FastLinkedListNodeAt(nodes, node_idx).next_node_idx; }
+    const index_type& next(size_type node_idx) const {
+      return detail::FastLinkedListNodeAt(nodes, node_idx).next_node_idx;
+    }
+
+    std::array<Node, _N> nodes;
+  };
+
+  /// @brief Nodes stored as an array of values and a parallel array of links
+  struct StructOfArrays {
+    ValueStorage& storage(size_type node_idx) { return detail::FastLinkedListNodeAt(values, node_idx); }
+    const ValueStorage& storage(size_type node_idx) const { return detail::FastLinkedListNodeAt(values, node_idx); }
+
+    index_type& next(size_type node_idx) { return detail::FastLinkedListNodeAt(next_node_idxs, node_idx); }
+    const index_type& next(size_type node_idx) const {
+      return detail::FastLinkedListNodeAt(next_node_idxs, node_idx);
+    }
+
+    std::array<ValueStorage, _N> values;
+    std::array<index_type, _N>   next_node_idxs;
   };
 
-  void Initialize(const _Tp& default_value);
+  /// @brief Value stored in a node that is part of the list
+  reference Value(size_type node_idx);
+
+  const_reference Value(size_type node_idx) const;
+
+  /// @brief Index of the node that follows node_idx
+  index_type& Next(size_type node_idx);
+
+  index_type Next(size_type node_idx) const;
+
+  /// @brief Link that points at the node after node_idx, which may be the before begin position
+  index_type& LinkAfter(size_type node_idx);
 
+  index_type LinkAfter(size_type node_idx) const;
+
+  /// @brief Takes a node from the recycled nodes list, or from the high water mark if that list is empty
+  size_type AllocateNode() noexcept;
+
+  /// @brief Destroys the value in node_idx, which must already be unlinked, and recycles the node
   void ReturnToAvailableNodesList(size_type node_idx);
 
-  std::array<Node, _N> list_;
+  /// @brief Destroys the first num_elements elements of the list, without touching the bookkeeping
+  void DestroyElements(size_type num_elements) noexcept;
+
+  /// @brief Constructs every element of other in the node with the same index; the list must be empty
+  template <typename _List>
+  void ConstructFrom(_List&& other);
+
+  /// @brief Erases every element for which pred returns true
+  /// @param p_deferred_value element of this list that pred still needs; if it is erased, it's destroyed last
+  template <typename _Pred>
+  void RemoveIf(_Pred pred, const value_type* p_deferred_value);
+
+  /// Index used by before_begin(); no node has it
+  static constexpr size_type kBeforeBeginIdx = _N + 1;
+
+  std::conditional_t<b_struct_of_arrays, StructOfArrays, ArrayOfStructs> list_;
 
   // when the list is empty, this points at the end
-  size_type start_node_idx_;
+  index_type start_node_idx_;
 
   // will always point one past the last element in the list_ container; "tail" will always be the
   // last element in the list_ container
   const size_type end_node_idx_;
 
-  size_type next_available_node_idx_;
+  // head of the list of nodes that were used and then released; _N when there are none
+  index_type next_available_node_idx_;
+
+  // nodes at or above this index have never been used since construction or the last clear()
+  size_type high_water_mark_;
 
   size_type num_nodes_;
 };
@@ -74,161 +295,466 @@ class FastLinkedList {
 
 namespace helpers::containers {
 
-template <typename _Tp, size_t _N>
-FastLinkedList<_Tp, _N>::FastLinkedList() : FastLinkedList(0) {}
-
-template <typename _Tp, size_t _N>
-FastLinkedList<_Tp, _N>::FastLinkedList(const _Tp& default_value)
-    : list_{}, start_node_idx_(_N), end_node_idx_(_N), next_available_node_idx_(_N - 1), num_nodes_(0) {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::FastLinkedList()
+    : start_node_idx_(_N), end_node_idx_(_N), next_available_node_idx_(_N), high_water_mark_(0), num_nodes_(0) {
   static_assert(_N != 0);
-  Initialize(default_value);
 }
 
-template <typename _Tp, size_t _N>
-auto FastLinkedList<_Tp, _N>::front() -> reference {
-  return list_.at(start_node_idx_).value;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::FastLinkedList(const _Tp&) : FastLinkedList() {}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::FastLinkedList(const FastLinkedList& other) : FastLinkedList() {
+  ConstructFrom(other);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::FastLinkedList(FastLinkedList&& other) noexcept(
+    std::is_nothrow_move_constructible<_Tp>::value)
+    : FastLinkedList() {
+  ConstructFrom(std::move(other));
+  other.clear();
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::operator=(const FastLinkedList& other) -> FastLinkedList& {
+  if (this != &other) {
+    clear();
+    ConstructFrom(other);
+  }
+
+  return *this;
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::operator=(FastLinkedList&& other) noexcept(
+    std::is_nothrow_move_constructible<_Tp>::value) -> FastLinkedList& {
+  if (this != &other) {
+    clear();
+    ConstructFrom(std::move(other));
+    other.clear();
+  }
+
+  return *this;
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::~FastLinkedList() {
+  DestroyElements(num_nodes_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::front() -> reference {
+  return Value(start_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::front() const -> const_reference {
+  return Value(start_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::before_begin() noexcept -> iterator {
+  return iterator(this, kBeforeBeginIdx);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::before_begin() const noexcept -> const_iterator {
+  return const_iterator(this, kBeforeBeginIdx);
 }
 
-template <typename _Tp, size_t _N>
-auto FastLinkedList<_Tp, _N>::front() const -> const_reference {
-  return list_.at(start_node_idx_).value;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::cbefore_begin() const noexcept -> const_iterator {
+  return before_begin();
 }
 
-template <typename _Tp, size_t _N>
-bool FastLinkedList<_Tp, _N>::empty() const noexcept {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::begin() noexcept -> iterator {
+  return iterator(this, start_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::begin() const noexcept -> const_iterator {
+  return const_iterator(this, start_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::cbegin() const noexcept -> const_iterator {
+  return begin();
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::end() noexcept -> iterator {
+  return iterator(this, end_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::end() const noexcept -> const_iterator {
+  return const_iterator(this, end_node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::cend() const noexcept -> const_iterator {
+  return end();
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+bool FastLinkedList<_Tp, _N, b_struct_of_arrays>::empty() const noexcept {
   return start_node_idx_ == end_node_idx_;
 }
 
-template <typename _Tp, size_t _N>
-bool FastLinkedList<_Tp, _N>::full() const noexcept {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+bool FastLinkedList<_Tp, _N, b_struct_of_arrays>::full() const noexcept {
   return num_nodes_ == _N;
 }
 
-template <typename _Tp, size_t _N>
-auto FastLinkedList<_Tp, _N>::size() const noexcept -> size_type {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::size() const noexcept -> size_type {
   return num_nodes_;
 }
 
-template <typename _Tp, size_t _N>
-auto FastLinkedList<_Tp, _N>::max_size() const noexcept -> size_type {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::max_size() const noexcept -> size_type {
   return _N;
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::clear() noexcept {
-  clear(_Tp{});
-}
-
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::clear(const _Tp& default_value) noexcept {
-  Initialize(default_value);
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::clear() noexcept {
+  DestroyElements(num_nodes_);
 
   start_node_idx_          = _N;
-  next_available_node_idx_ = _N - 1;
+  next_available_node_idx_ = _N;
+  high_water_mark_         = 0;
   num_nodes_               = 0;
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::push_front(const _Tp& value) {
-  if (!full()) {
-    // save the next available node after the current one has been used up
-    auto new_next_available_node_idx = list_.at(next_available_node_idx_).next_node_idx;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::clear(const _Tp&) noexcept {
+  clear();
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::push_front(const _Tp& value) {
+  emplace_front(value);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::push_front(_Tp&& value) {
+  emplace_front(std::move(value));
+}
 
-    // assign value
-    // then update the pointer of the current node to point at the node that start_node_idx_ was previously pointing at
-    // finally, update the start_node_idx_ pointer to point at the new node
-    list_.at(next_available_node_idx_).value         = value;
-    list_.at(next_available_node_idx_).next_node_idx = start_node_idx_;
-    start_node_idx_                                  = next_available_node_idx_;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <typename... _Args>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::emplace_front(_Args&&... args) {
+  emplace_after(cbefore_begin(), std::forward<_Args>(args)...);
+}
 
-    // the new next_available_node will now be assigned the saved value
-    next_available_node_idx_ = new_next_available_node_idx;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::pop_front() {
+  if (!empty()) {
+    // save the pointer to the node to be removed
+    auto node_to_remove_idx = start_node_idx_;
 
-    ++num_nodes_;
+    // update the pointer to the start node to point at the next node in the list
+    start_node_idx_ = Next(start_node_idx_);
+
+    ReturnToAvailableNodesList(node_to_remove_idx);
   }
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::push_front(_Tp&& value) {
-  if (!full()) {
-    // save the next available node after the current one has been used up
-    auto new_next_available_node_idx = list_.at(next_available_node_idx_).next_node_idx;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::insert_after(const_iterator pos, const _Tp& value) -> iterator {
+  return emplace_after(pos, value);
+}
 
-    // assign value
-    // then update the pointer of the current node to point at the node that start_node_idx_ was previously pointing at
-    // finally, update the start_node_idx_ to point at the new node
-    list_.at(next_available_node_idx_).value         = std::move(value);
-    list_.at(next_available_node_idx_).next_node_idx = start_node_idx_;
-    start_node_idx_                                  = next_available_node_idx_;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::insert_after(const_iterator pos, _Tp&& value) -> iterator {
+  return emplace_after(pos, std::move(value));
+}
 
-    // the new next_available_node will now be assigned the saved value
-    next_available_node_idx_ = new_next_available_node_idx;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <typename... _Args>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::emplace_after(const_iterator pos, _Args&&... args) -> iterator {
+  if (full()) {
+    return end();
+  }
 
-    ++num_nodes_;
+  const auto new_node_idx = AllocateNode();
+
+  // construct the value; if that throws, the node goes back to the recycled nodes list
+  try {
+    ::new (static_cast<void*>(list_.storage(new_node_idx).bytes)) value_type(std::forward<_Args>(args)...);
+  } catch (...) {
+    Next(new_node_idx)       = next_available_node_idx_;
+    next_available_node_idx_ = new_node_idx;
+    throw;
   }
+
+  // update the pointer of the new node to point at the node that followed pos
+  // then update the link after pos to point at the new node
+  auto& link_after_pos = LinkAfter(pos.node_idx_);
+  Next(new_node_idx)   = link_after_pos;
+  link_after_pos       = new_node_idx;
+
+  ++num_nodes_;
+
+  return iterator(this, new_node_idx);
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::pop_front() {
-  if (!empty()) {
-    // save the pointer to the node to be removed
-    auto node_to_remove_idx = start_node_idx_;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::erase_after(const_iterator pos) -> iterator {
+  auto&      link_after_pos     = LinkAfter(pos.node_idx_);
+  const auto node_to_remove_idx = link_after_pos;
 
-    // update the pointer to the start node to point at the next node in the list
-    start_node_idx_ = list_.at(start_node_idx_).next_node_idx;
+  link_after_pos = Next(node_to_remove_idx);
+  ReturnToAvailableNodesList(node_to_remove_idx);
 
-    ReturnToAvailableNodesList(node_to_remove_idx);
+  return iterator(this, link_after_pos);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::erase_after(const_iterator first, const_iterator last) -> iterator {
+  while (LinkAfter(first.node_idx_) != last.node_idx_) {
+    erase_after(first);
   }
+
+  return iterator(this, last.node_idx_);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::remove(const _Tp& value) {
+  // value may refer to an element of this list, so that element must stay alive until the search is done
+  RemoveIf([&value](const value_type& element) { return element == value; }, &value);
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::remove(const _Tp& value) {
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <typename _Pred>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::remove_if(_Pred pred) {
+  RemoveIf(pred, nullptr);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::splice_after(const_iterator pos, FastLinkedList& other) {
+  splice_after(pos, other, other.cbefore_begin(), other.cend());
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::splice_after(const_iterator pos, FastLinkedList& other,
+                                                               const_iterator it) {
+  splice_after(pos, other, it, std::next(it, 2));
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::splice_after(const_iterator pos, FastLinkedList& other,
+                                                               const_iterator first, const_iterator last) {
+  if (&other == this) {
+    const size_type first_moved_idx = LinkAfter(first.node_idx_);
+    if (first_moved_idx == last.node_idx_) {
+      return;
+    }
+
+    auto last_moved_idx = first_moved_idx;
+    while (Next(last_moved_idx) != last.node_idx_) {
+      last_moved_idx = Next(last_moved_idx);
+    }
+
+    // unlink (first, last), then link it back in after pos
+    LinkAfter(first.node_idx_) = last.node_idx_;
+    Next(last_moved_idx)       = LinkAfter(pos.node_idx_);
+    LinkAfter(pos.node_idx_)   = first_moved_idx;
+    return;
+  }
+
+  size_type num_moved = 0;
+  for (auto node_idx = other.LinkAfter(first.node_idx_); node_idx != last.node_idx_; node_idx = other.Next(node_idx)) {
+    ++num_moved;
+  }
+
+  if (num_moved > _N - num_nodes_) {
+    throw std::length_error("FastLinkedList::splice_after");
+  }
+
+  // elements keep their order: each one is inserted after the one moved before it
+  auto insert_pos = pos;
+  while (other.LinkAfter(first.node_idx_) != last.node_idx_) {
+    insert_pos = emplace_after(insert_pos, std::move(other.Value(other.LinkAfter(first.node_idx_))));
+    other.erase_after(first);
+  }
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Value(size_type node_idx) -> reference {
+  return *std::launder(reinterpret_cast<value_type*>(list_.storage(node_idx).bytes));
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Value(size_type node_idx) const -> const_reference {
+  return *std::launder(reinterpret_cast<const value_type*>(list_.storage(node_idx).bytes));
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Next(size_type node_idx) -> index_type& {
+  return list_.next(node_idx);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Next(size_type node_idx) const -> index_type {
+  return list_.next(node_idx);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::LinkAfter(size_type node_idx) -> index_type& {
+  return node_idx == kBeforeBeginIdx ? start_node_idx_ : Next(node_idx);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::LinkAfter(size_type node_idx) const -> index_type {
+  return node_idx == kBeforeBeginIdx ? start_node_idx_ : Next(node_idx);
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::AllocateNode() noexcept -> size_type {
+  // recycled nodes are preferred, they're more likely to still be in cache
+  if (next_available_node_idx_ != end_node_idx_) {
+    const auto node_idx      = next_available_node_idx_;
+    next_available_node_idx_ = Next(node_idx);
+    return node_idx;
+  }
+
+  return high_water_mark_++;
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::ReturnToAvailableNodesList(size_type node_idx) {
+  Value(node_idx).~value_type();
+
+  Next(node_idx)           = next_available_node_idx_;
+  next_available_node_idx_ = node_idx;
+
+  --num_nodes_;
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::DestroyElements(size_type num_elements) noexcept {
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    for (auto node_idx = start_node_idx_; num_elements != 0; --num_elements) {
+      const auto next_node_idx = Next(node_idx);
+      Value(node_idx).~value_type();
+      node_idx = next_node_idx;
+    }
+  }
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <typename _List>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::ConstructFrom(_List&& other) {
+  // the links of every node below the high water mark are copied, so the recycled nodes list is identical too
+  for (size_type node_idx = 0; node_idx < other.high_water_mark_; ++node_idx) {
+    Next(node_idx) = other.Next(node_idx);
+  }
+
+  start_node_idx_ = other.start_node_idx_;
+
+  // num_nodes_ counts the elements constructed so far, which are the ones to destroy if a copy throws
+  try {
+    for (auto node_idx = start_node_idx_; node_idx != end_node_idx_; node_idx = Next(node_idx)) {
+      if constexpr (std::is_lvalue_reference<_List>::value) {
+        ::new (static_cast<void*>(list_.storage(node_idx).bytes)) value_type(other.Value(node_idx));
+      } else {
+        ::new (static_cast<void*>(list_.storage(node_idx).bytes)) value_type(std::move(other.Value(node_idx)));
+      }
+      ++num_nodes_;
+    }
+  } catch (...) {
+    DestroyElements(num_nodes_);
+    start_node_idx_ = end_node_idx_;
+    num_nodes_      = 0;
+    throw;
+  }
+
+  next_available_node_idx_ = other.next_available_node_idx_;
+  high_water_mark_         = other.high_water_mark_;
+}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <typename _Pred>
+void FastLinkedList<_Tp, _N, b_struct_of_arrays>::RemoveIf(_Pred pred, const value_type* p_deferred_value) {
   if (empty()) {
     return;
   }
 
+  // the element at p_deferred_value is unlinked like the others, but only destroyed at the end, once pred is done
+  auto deferred_node_idx = end_node_idx_;
+
   // save pointer to starting node; need a copy because this pointer will be modified while searching
   auto* p_memory_that_stores_idx_to_current_node = &start_node_idx_;
 
   // checked if list is empty already, so there's at least one node in the list
   do {
-    if (list_.at(*p_memory_that_stores_idx_to_current_node).value == value) {
+    if (pred(Value(*p_memory_that_stores_idx_to_current_node))) {
       // save the pointer to the node that will be removed
       // this node will then be added back to list of available nodes for reuse
       auto node_to_remove_idx = (*p_memory_that_stores_idx_to_current_node);
 
       // update pointer to point at the object AFTER the one that is being removed
-      *p_memory_that_stores_idx_to_current_node = list_.at(node_to_remove_idx).next_node_idx;
+      *p_memory_that_stores_idx_to_current_node = Next(node_to_remove_idx);
 
       // add the node back to the free store
-      ReturnToAvailableNodesList(node_to_remove_idx);
+      if (&Value(node_to_remove_idx) == p_deferred_value) {
+        deferred_node_idx = node_to_remove_idx;
+      } else {
+        ReturnToAvailableNodesList(node_to_remove_idx);
+      }
     } else {
       // update double pointer
       // this will now store the memory address of the next node's next_node_idx
-      p_memory_that_stores_idx_to_current_node = &list_.at(*p_memory_that_stores_idx_to_current_node).next_node_idx;
+      p_memory_that_stores_idx_to_current_node = &Next(*p_memory_that_stores_idx_to_current_node);
     }
   } while (*p_memory_that_stores_idx_to_current_node != end_node_idx_);
+
+  if (deferred_node_idx != end_node_idx_) {
+    ReturnToAvailableNodesList(deferred_node_idx);
+  }
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::Initialize(const _Tp& default_value) {
-  list_.front().value         = default_value;
-  list_.front().next_node_idx = end_node_idx_;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+template <bool b_other_const, typename>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::Iterator(const Iterator<b_other_const>& other) noexcept
+    : p_list_(other.p_list_), node_idx_(other.node_idx_) {}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::Iterator(list_pointer p_list,
+                                                                        size_type    node_idx) noexcept
+    : p_list_(p_list), node_idx_(node_idx) {}
+
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::operator*() const -> reference {
+  return p_list_->Value(node_idx_);
+}
 
-  // current node at reverse_index sets its next_node_idx to the node to its left
-  // this will initialize the free store
-  for (auto reverse_index = _N - 1; reverse_index != 0; --reverse_index) {
-    list_.at(reverse_index).value         = default_value;
-    list_.at(reverse_index).next_node_idx = reverse_index - 1;
-  }
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::operator->() const -> pointer {
+  return &p_list_->Value(node_idx_);
 }
 
-template <typename _Tp, size_t _N>
-void FastLinkedList<_Tp, _N>::ReturnToAvailableNodesList(size_type node_idx) {
-  list_.at(node_idx).next_node_idx = next_available_node_idx_;
-  next_available_node_idx_         = node_idx;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::operator++() -> Iterator& {
+  node_idx_ = p_list_->LinkAfter(node_idx_);
+  return *this;
+}
 
-  --num_nodes_;
+template <typename _Tp, size_t _N, bool b_struct_of_arrays>
+template <bool b_const>
+auto FastLinkedList<_Tp, _N, b_struct_of_arrays>::Iterator<b_const>::operator++(int) -> Iterator {
+  auto iter = *this;
+  ++(*this);
+  return iter;
 }
 
 }  // namespace helpers::containers
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "FastDoublyLinkedList.hpp"
+
+namespace helpers::containers {
+
+/// @brief Eviction callback that does nothing
+/// Default callback for FixedLruCache; compiles away entirely
+struct NoEvictionCallback {
+  template <typename _Key, typename _Tp>
+  void operator()(const _Key&, _Tp&) const noexcept {}
+};
+
+/// @brief Least recently used cache with a fixed capacity that never allocates
+/// Entries live in a FastDoublyLinkedList ordered from most to least recently used, and are found through an open
+/// addressing hash table (linear probing, at most half full) that stores list handles. Both are plain arrays inside the
+/// cache object, so a lookup touches one or two table cache lines and the entry's node.
+/// @tparam _Key key type
+/// @tparam _Tp value type
+/// @tparam _N maximum number of entries
+/// @tparam _Hash functor used to hash keys; its output is remixed, so identity hashes (std::hash<int>) are fine
+/// @tparam _OnEvict callable as on_evict(const _Key&, _Tp&), invoked just before an entry is evicted to make room for
+/// a new one; it may move the value out. It isn't invoked by erase() or clear().
+template <typename _Key, typename _Tp, size_t _N, typename _Hash = std::hash<_Key>,
+          typename _OnEvict = NoEvictionCallback>
+class FixedLruCache {
+ public:
+  using key_type    = _Key;
+  using mapped_type = _Tp;
+  using hasher      = _Hash;
+  using size_type   = size_t;
+
+  static_assert(_N != 0);
+  static_assert(_N <= (size_t{1} << 30), "FixedLruCache hashes keys to 32 bits");
+
+  explicit FixedLruCache(_OnEvict on_evict = _OnEvict{}, _Hash hash = _Hash{});
+
+  FixedLruCache(const FixedLruCache&) = delete;
+  FixedLruCache(FixedLruCache&&)      = delete;
+  FixedLruCache& operator=(const FixedLruCache&) = delete;
+  FixedLruCache& operator=(FixedLruCache&&) = delete;
+
+  ~FixedLruCache() = default;
+
+  /// @brief Looks up key and marks it as the most recently used entry
+  /// @return pointer to the value, valid until the entry is evicted or erased; nullptr if key isn't cached
+  mapped_type* get(const key_type& key);
+
+  /// @brief Looks up key without changing its recency
+  const mapped_type* peek(const key_type& key) const;
+
+  bool contains(const key_type& key) const;
+
+  /// @brief Inserts key or replaces its value, and marks it as the most recently used entry
+  /// If the cache is full and key is new, the least recently used entry is evicted first
+  /// @return reference to the stored value
+  mapped_type& put(const key_type& key, mapped_type value);
+
+  /// @return false if key wasn't cached
+  bool erase(const key_type& key);
+
+  void clear() noexcept;
+
+  size_type size() const noexcept;
+
+  bool empty() const noexcept;
+
+  size_type capacity() const noexcept;
+
+ private:
+  struct Entry {
+    Entry(const key_type& entry_key, mapped_type&& entry_value) : key(entry_key), value(std::move(entry_value)) {}
+
+    const key_type key;
+    mapped_type    value;
+  };
+
+  using list_type = FastDoublyLinkedList<Entry, _N>;
+  using handle    = typename list_type::Handle;
+
+  struct Slot {
+    // null when the slot is empty
+    handle entry;
+
+    // hash of the entry's key, compared before the key itself
+    uint32_t hash;
+  };
+
+  /// @brief Smallest power of two that keeps the table at most half full
+  static constexpr size_type TableSize() noexcept;
+
+  static constexpr size_type kTableSize = TableSize();
+  static constexpr size_type kTableMask = kTableSize - 1;
+  static constexpr size_type kNotFound  = kTableSize;
+
+  /// @brief murmur3 64 bit finalizer, spreads the entropy of the key's hash over every bit
+  static uint64_t Mix(uint64_t hash) noexcept;
+
+  uint32_t Hash(const key_type& key) const;
+
+  /// @return index of the slot that holds key, or kNotFound
+  size_type FindSlot(const key_type& key, uint32_t hash) const;
+
+  /// @brief Empties a slot and shifts the following slots of its probe run back, so no tombstones are needed
+  void EraseSlot(size_type slot_idx) noexcept;
+
+  /// @brief Evicts the least recently used entry
+  void EvictOne();
+
+  hasher hash_;
+
+  _OnEvict on_evict_;
+
+  /// front is the most recently used entry
+  list_type recency_;
+
+  std::array<Slot, kTableSize> slots_;
+};
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::FixedLruCache(_OnEvict on_evict, _Hash hash)
+    : hash_(std::move(hash)), on_evict_(std::move(on_evict)), slots_{} {}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::get(const key_type& key) -> mapped_type* {
+  const auto slot_idx = FindSlot(key, Hash(key));
+
+  if (slot_idx == kNotFound) {
+    return nullptr;
+  }
+
+  const auto entry = slots_[slot_idx].entry;
+  recency_.move_to_front(entry);
+  return &recency_.at(entry).value;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::peek(const key_type& key) const -> const mapped_type* {
+  const auto slot_idx = FindSlot(key, Hash(key));
+
+  if (slot_idx == kNotFound) {
+    return nullptr;
+  }
+
+  return &recency_.at(slots_[slot_idx].entry).value;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+bool FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::contains(const key_type& key) const {
+  return FindSlot(key, Hash(key)) != kNotFound;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::put(const key_type& key, mapped_type value) -> mapped_type& {
+  const auto hash     = Hash(key);
+  const auto slot_idx = FindSlot(key, hash);
+
+  if (slot_idx != kNotFound) {
+    const auto entry = slots_[slot_idx].entry;
+    auto&      found = recency_.at(entry).value;
+
+    found = std::move(value);
+    recency_.move_to_front(entry);
+    return found;
+  }
+
+  if (recency_.full()) {
+    EvictOne();
+  }
+
+  const auto entry = recency_.emplace_front(key, std::move(value));
+
+  // the table is at most half full, so there's always an empty slot
+  auto empty_slot_idx = hash & kTableMask;
+  while (slots_[empty_slot_idx].entry) {
+    empty_slot_idx = (empty_slot_idx + 1) & kTableMask;
+  }
+
+  slots_[empty_slot_idx] = Slot{entry, hash};
+  return recency_.at(entry).value;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+bool FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::erase(const key_type& key) {
+  const auto slot_idx = FindSlot(key, Hash(key));
+
+  if (slot_idx == kNotFound) {
+    return false;
+  }
+
+  recency_.erase(slots_[slot_idx].entry);
+  EraseSlot(slot_idx);
+  return true;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+void FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::clear() noexcept {
+  recency_.clear();
+  slots_.fill(Slot{});
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::size() const noexcept -> size_type {
+  return recency_.size();
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+bool FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::empty() const noexcept {
+  return recency_.empty();
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::capacity() const noexcept -> size_type {
+  return _N;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+constexpr auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::TableSize() noexcept -> size_type {
+  size_type table_size = 1;
+  while (table_size < 2 * _N) {
+    table_size *= 2;
+  }
+
+  return table_size;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+uint64_t FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::Mix(uint64_t hash) noexcept {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+uint32_t FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::Hash(const key_type& key) const {
+  return static_cast<uint32_t>(Mix(hash_(key)));
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+auto FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::FindSlot(const key_type& key, uint32_t hash) const -> size_type {
+  for (auto slot_idx = hash & kTableMask;; slot_idx = (slot_idx + 1) & kTableMask) {
+    const auto& slot = slots_[slot_idx];
+
+    if (!slot.entry) {
+      return kNotFound;
+    }
+
+    if (slot.hash == hash && recency_.at(slot.entry).key == key) {
+      return slot_idx;
+    }
+  }
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+void FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::EraseSlot(size_type slot_idx) noexcept {
+  auto hole_idx = slot_idx;
+
+  for (auto next_idx = (hole_idx + 1) & kTableMask; slots_[next_idx].entry; next_idx = (next_idx + 1) & kTableMask) {
+    const size_type home_idx = slots_[next_idx].hash & kTableMask;
+
+    // the entry can fill the hole unless its home slot lies cyclically in (hole_idx, next_idx]
+    const auto distance_to_hole = (next_idx - hole_idx) & kTableMask;
+    const auto distance_to_home = (next_idx - home_idx) & kTableMask;
+
+    if (distance_to_home >= distance_to_hole) {
+      slots_[hole_idx] = slots_[next_idx];
+      hole_idx         = next_idx;
+    }
+  }
+
+  slots_[hole_idx] = Slot{};
+}
+
+template <typename _Key, typename _Tp, size_t _N, typename _Hash, typename _OnEvict>
+void FixedLruCache<_Key, _Tp, _N, _Hash, _OnEvict>::EvictOne() {
+  const auto lru_entry = std::prev(recency_.end()).handle();
+  auto&      lru       = recency_.at(lru_entry);
+
+  // the callback runs first, so if it throws, nothing has been evicted
+  on_evict_(lru.key, lru.value);
+
+  const auto slot_idx = FindSlot(lru.key, Hash(lru.key));
+  recency_.erase(lru_entry);
+  EraseSlot(slot_idx);
+}
+
+}  // namespace helpers::containers
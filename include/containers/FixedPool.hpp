@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <utility>
+
+#include "FastLinkedList.hpp"
+
+namespace helpers::containers {
+
+/// @brief Pool of _N uninitialized slots for objects of type _Tp, with O(1) allocation and no dynamic allocation
+/// Uses the same free list as FastLinkedList: released slots are recycled first and the others are handed out in order
+/// from a high water mark, so construction is O(1). A released slot keeps the index of the next released slot in its
+/// own storage, so the pool has no per-slot overhead beyond _Tp itself.
+/// @tparam _Tp type of the objects stored in the pool
+/// @tparam _N number of slots
+template <typename _Tp, size_t _N>
+class FixedPool {
+ public:
+  using value_type = _Tp;
+  using pointer    = value_type*;
+  using size_type  = size_t;
+  using index_type = detail::FastLinkedListIndex<_N>;
+
+  FixedPool() noexcept;
+
+  FixedPool(const FixedPool&) = delete;
+  FixedPool(FixedPool&&)      = delete;
+  FixedPool& operator=(const FixedPool&) = delete;
+  FixedPool& operator=(FixedPool&&) = delete;
+
+  /// @brief Doesn't destroy objects that are still constructed in the pool
+  ~FixedPool() = default;
+
+  /// @return uninitialized storage for one _Tp, or nullptr if every slot is in use
+  pointer allocate() noexcept;
+
+  /// @param p pointer returned by allocate(), whose object (if any) has already been destroyed
+  void deallocate(pointer p) noexcept;
+
+  /// @brief Allocates a slot and constructs an object in it
+  /// @return the new object, or nullptr if every slot is in use
+  template <typename... _Args>
+  pointer construct(_Args&&... args);
+
+  /// @brief Destroys an object created by construct() and releases its slot
+  void destroy(pointer p) noexcept;
+
+  /// @return true if p points into this pool's storage
+  bool owns(const void* p) const noexcept;
+
+  bool empty() const noexcept;
+
+  bool full() const noexcept;
+
+  /// @return number of slots in use
+  size_type size() const noexcept;
+
+  size_type capacity() const noexcept;
+
+ private:
+  union Slot {
+    alignas(value_type) std::byte storage[sizeof(value_type)];
+
+    // only valid while the slot is released
+    index_type next_slot_idx;
+  };
+
+  size_type SlotIndex(pointer p) const noexcept;
+
+  std::array<Slot, _N> slots_;
+
+  // head of the list of slots that were used and then released; _N when there are none
+  index_type next_available_slot_idx_;
+
+  // slots at or above this index have never been used
+  size_type high_water_mark_;
+
+  size_type num_slots_used_;
+};
+
+}  // namespace helpers::containers
+
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+// *********************************************************************************************************************
+
+namespace helpers::containers {
+
+template <typename _Tp, size_t _N>
+FixedPool<_Tp, _N>::FixedPool() noexcept
+    : next_available_slot_idx_(_N), high_water_mark_(0), num_slots_used_(0) {
+  static_assert(_N != 0);
+}
+
+template <typename _Tp, size_t _N>
+auto FixedPool<_Tp, _N>::allocate() noexcept -> pointer {
+  size_type slot_idx = next_available_slot_idx_;
+
+  // recycled slots are preferred, they're more likely to still be in cache
+  if (slot_idx != _N) {
+    next_available_slot_idx_ = slots_[slot_idx].next_slot_idx;
+  } else if (high_water_mark_ != _N) {
+    slot_idx = high_water_mark_++;
+  } else {
+    return nullptr;
+  }
+
+  ++num_slots_used_;
+  return reinterpret_cast<pointer>(slots_[slot_idx].storage);
+}
+
+template <typename _Tp, size_t _N>
+void FixedPool<_Tp, _N>::deallocate(pointer p) noexcept {
+  const auto slot_idx = SlotIndex(p);
+
+  slots_[slot_idx].next_slot_idx = next_available_slot_idx_;
+  next_available_slot_idx_       = slot_idx;
+
+  --num_slots_used_;
+}
+
+template <typename _Tp, size_t _N>
+template <typename... _Args>
+auto FixedPool<_Tp, _N>::construct(_Args&&... args) -> pointer {
+  auto* p_storage = allocate();
+  if (p_storage == nullptr) {
+    return nullptr;
+  }
+
+  try {
+    return ::new (static_cast<void*>(p_storage)) value_type(std::forward<_Args>(args)...);
+  } catch (...) {
+    deallocate(p_storage);
+    throw;
+  }
+}
+
+template <typename _Tp, size_t _N>
+void FixedPool<_Tp, _N>::destroy(pointer p) noexcept {
+  p->~value_type();
+  deallocate(p);
+}
+
+template <typename _Tp, size_t _N>
+bool FixedPool<_Tp, _N>::owns(const void* p) const noexcept {
+  const auto* p_byte  = static_cast<const std::byte*>(p);
+  const auto* p_begin = slots_.front().storage;
+  const auto* p_end   = p_begin + sizeof(slots_);
+
+  // std::less gives a total order even for pointers into unrelated objects
+  return !std::less<const std::byte*>()(p_byte, p_begin) && std::less<const std::byte*>()(p_byte, p_end);
+}
+
+template <typename _Tp, size_t _N>
+bool FixedPool<_Tp, _N>::empty() const noexcept {
+  return num_slots_used_ == 0;
+}
+
+template <typename _Tp, size_t _N>
+bool FixedPool<_Tp, _N>::full() const noexcept {
+  return num_slots_used_ == _N;
+}
+
+template <typename _Tp, size_t _N>
+auto FixedPool<_Tp, _N>::size() const noexcept -> size_type {
+  return num_slots_used_;
+}
+
+template <typename _Tp, size_t _N>
+auto FixedPool<_Tp, _N>::capacity() const noexcept -> size_type {
+  return _N;
+}
+
+template <typename _Tp, size_t _N>
+auto FixedPool<_Tp, _N>::SlotIndex(pointer p) const noexcept -> size_type {
+  const auto byte_offset = reinterpret_cast<const std::byte*>(p) - slots_.front().storage;
+  return static_cast<size_type>(byte_offset) / sizeof(Slot);
+}
+
+}  // namespace helpers::containers
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "Vector2DExpression.hpp"
+#include "Vector2DLayout.hpp"
+#include "Vector2DView.hpp"
+
+namespace helpers::containers {
+
+/// @brief Vector2D whose dimensions are known at compile time, eg a 4 x 4 matrix
+/// The elements live in a std::array inside the object, so it needs no heap allocation, stores no dimensions, and
+/// every offset is a compile time constant the compiler can fold or unroll. Construction and element access are
+/// constexpr. It has the same API as Vector2D, minus resizing.
+/// @tparam _Tp element type
+/// @tparam _Rows, _Columns dimensions
+/// @tparam _Layout maps (row, column) to a position in the array; RowMajorLayout, TiledLayout or PaddedRowMajorLayout
+template <typename _Tp, size_t _Rows, size_t _Columns, typename _Layout = RowMajorLayout>
+class FixedVector2D {
+  public:
+    using value_type  = _Tp;
+    using layout_type = _Layout;
+
+    static_assert(_Layout::kAlignment == 0 || (_Layout::Offset(1, 0, 1) * sizeof(_Tp)) % _Layout::kAlignment == 0,
+                  "the layout doesn't keep rows of this element type aligned");
+
+    struct Dimensions {
+        size_t rows;
+        size_t columns;
+    };
+
+    using view_type       = Vector2DView<_Tp, _Layout>;
+    using const_view_type = Vector2DView<const _Tp, _Layout>;
+
+    /// Iterators visit the elements in row-major order, whatever the layout
+    using iterator       = typename view_type::iterator;
+    using const_iterator = typename const_view_type::iterator;
+
+    /// @brief Value-initializes every element
+    constexpr FixedVector2D() = default;
+
+    constexpr explicit FixedVector2D(const _Tp& default_value) {
+        for (auto& element : array_) {
+            element = default_value;
+        }
+    }
+
+    /// @brief Row by row initialization, eg FixedVector2D<int, 2, 3> m{{1, 2, 3}, {4, 5, 6}}; missing elements are
+    /// value-initialized
+    /// @throw std::invalid_argument if there are more rows or columns than _Rows or _Columns
+    constexpr FixedVector2D(std::initializer_list<std::initializer_list<_Tp>> rows) {
+        if (rows.size() > _Rows) {
+            throw std::invalid_argument("");
+        }
+
+        size_t row = 0;
+        for (const auto& columns : rows) {
+            if (columns.size() > _Columns) {
+                throw std::invalid_argument("");
+            }
+
+            size_t column = 0;
+            for (const auto& element : columns) {
+                array_[_Layout::Offset(row, column++, _Columns)] = element;
+            }
+
+            ++row;
+        }
+    }
+
+    /// @brief Evaluates an element-wise expression
+    /// @throw std::invalid_argument if its dimensions aren't _Rows x _Columns
+    template <typename _Expr>
+    FixedVector2D(const Vector2DExpression<_Expr>& expression) {
+        detail::Assign(view(), expression.derived());
+    }
+
+    /// @brief Evaluates an element-wise expression in a single pass; it may refer to this vector
+    /// @throw std::invalid_argument if its dimensions aren't _Rows x _Columns
+    template <typename _Expr>
+    FixedVector2D& operator=(const Vector2DExpression<_Expr>& expression) {
+        detail::Assign(view(), expression.derived());
+        return *this;
+    }
+
+    /// @brief Element-wise compound assignment of a Vector2D, Vector2DView, expression or scalar
+    /// @throw std::invalid_argument if rhs is 2D and its dimensions aren't _Rows x _Columns
+    template <typename _Rhs>
+    FixedVector2D& operator+=(const _Rhs& rhs) {
+        detail::Assign(view(), *this + rhs);
+        return *this;
+    }
+
+    template <typename _Rhs>
+    FixedVector2D& operator-=(const _Rhs& rhs) {
+        detail::Assign(view(), *this - rhs);
+        return *this;
+    }
+
+    template <typename _Rhs>
+    FixedVector2D& operator*=(const _Rhs& rhs) {
+        detail::Assign(view(), *this * rhs);
+        return *this;
+    }
+
+    template <typename _Rhs>
+    FixedVector2D& operator/=(const _Rhs& rhs) {
+        detail::Assign(view(), *this / rhs);
+        return *this;
+    }
+
+    static constexpr Dimensions capacity() noexcept { return Dimensions{_Rows, _Columns}; }
+
+    /// @brief Distance between the first elements of consecutive rows, in elements; only for layouts whose rows are
+    /// contiguous, where row r starts at data() + r * stride()
+    static constexpr size_t stride() noexcept {
+        static_assert(view_type::kStridedRows, "rows of this layout aren't evenly strided");
+
+        return _Layout::Offset(1, 0, _Columns) - _Layout::Offset(0, 0, _Columns);
+    }
+
+    /// @brief First element of the storage, aligned to the layout's alignment
+    constexpr _Tp* data() noexcept { return array_.data(); }
+
+    constexpr const _Tp* data() const noexcept { return array_.data(); }
+
+    /// @throw std::out_of_range if row or column is past the end
+    constexpr _Tp& at(size_t row, size_t column) { return array_[FlattenDimensions(row, column)]; }
+
+    constexpr const _Tp& at(size_t row, size_t column) const { return array_[FlattenDimensions(row, column)]; }
+
+    constexpr _Tp& operator()(size_t row, size_t column) { return array_[_Layout::Offset(row, column, _Columns)]; }
+
+    constexpr const _Tp& operator()(size_t row, size_t column) const {
+        return array_[_Layout::Offset(row, column, _Columns)];
+    }
+
+    iterator begin() { return view().begin(); }
+
+    iterator end() { return view().end(); }
+
+    const_iterator begin() const { return view().begin(); }
+
+    const_iterator end() const { return view().end(); }
+
+    view_type view() noexcept { return view_type(array_.data(), _Columns, 0, 0, _Rows, _Columns); }
+
+    const_view_type view() const noexcept { return const_view_type(array_.data(), _Columns, 0, 0, _Rows, _Columns); }
+
+    /// @return StridedSpan over the row for row-major layouts, otherwise a one row view
+    /// @throw std::out_of_range if row_idx is past the end
+    auto row(size_t row_idx) { return view().row(row_idx); }
+
+    auto row(size_t row_idx) const { return view().row(row_idx); }
+
+    /// @return StridedSpan over the column for row-major layouts, otherwise a one column view
+    /// @throw std::out_of_range if column_idx is past the end
+    auto column(size_t column_idx) { return view().column(column_idx); }
+
+    auto column(size_t column_idx) const { return view().column(column_idx); }
+
+    /// @brief View of num_rows x num_columns elements, starting at (first_row, first_column)
+    /// @throw std::out_of_range if the region doesn't fit in the vector
+    view_type subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) {
+        return view().subview(first_row, first_column, num_rows, num_columns);
+    }
+
+    const_view_type subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) const {
+        return view().subview(first_row, first_column, num_rows, num_columns);
+    }
+
+    /// @brief Calls func(row, column, element) for every element, one tile after the other, in storage order
+    template <typename _Func>
+    constexpr void for_each_by_tile(_Func func) {
+        ForEachByTile(*this, func);
+    }
+
+    template <typename _Func>
+    constexpr void for_each_by_tile(_Func func) const {
+        ForEachByTile(*this, func);
+    }
+
+  private:
+    /// @throw std::out_of_range if row or column is past the end
+    static constexpr size_t FlattenDimensions(size_t row, size_t column) {
+        if (row >= _Rows || column >= _Columns) {
+            throw std::out_of_range("");
+        }
+
+        return _Layout::Offset(row, column, _Columns);
+    }
+
+    template <typename _Self, typename _Func>
+    static constexpr void ForEachByTile(_Self& self, _Func& func) {
+        for (size_t first_row = 0; first_row < _Rows; first_row += _Layout::kTileRows) {
+            const size_t end_row = std::min(first_row + _Layout::kTileRows, _Rows);
+
+            for (size_t first_column = 0; first_column < _Columns;) {
+                const size_t end_column = first_column + std::min(_Layout::kTileColumns, _Columns - first_column);
+
+                for (size_t row = first_row; row < end_row; ++row) {
+                    for (size_t column = first_column; column < end_column; ++column) {
+                        func(row, column, self.array_[_Layout::Offset(row, column, _Columns)]);
+                    }
+                }
+
+                first_column = end_column;
+            }
+        }
+    }
+
+    /// Over-aligned layouts align the array, and with it the first element of every row
+    static constexpr size_t kAlignment = std::max(_Layout::kAlignment, alignof(_Tp));
+
+    alignas(kAlignment) std::array<_Tp, _Layout::StorageSize(_Rows, _Columns)> array_{};
+};
+
+}  // namespace helpers::containers
@@ -0,0 +1,353 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace helpers::containers {
+
+/// @brief ImmutableIntegerMap is an ImmutableMap for integral keys that stores its keys compressed
+/// Keys are split into fixed size blocks of consecutive (sorted) keys. A small top level index holds the first key of
+/// every block, and each block stores its keys as bit packed deltas from that base, using only as many bits as its
+/// largest delta needs. Values are stored in their own array so that they carry no key or padding. A lookup binary
+/// searches the index, then decodes only inside one block.
+/// @tparam _Key integral key type, ordered with std::less
+/// @tparam _Tp value type
+/// @tparam _BlockSize number of keys per block
+template <typename _Key, typename _Tp, size_t _BlockSize = 64>
+class ImmutableIntegerMap {
+ public:
+  using key_type        = _Key;
+  using mapped_type     = _Tp;
+  using value_type      = std::pair<key_type, const _Tp&>;
+  using size_type       = size_t;
+  using const_reference = const mapped_type&;
+
+  static_assert(std::is_integral<_Key>::value, "ImmutableIntegerMap requires an integral key type");
+  static_assert(_BlockSize != 0);
+
+  class const_iterator {
+   public:
+    const_iterator(const ImmutableIntegerMap* p_map, size_type idx) noexcept;
+    const_iterator(const const_iterator&) = default;
+    const_iterator(const_iterator&&)      = default;
+    const_iterator& operator=(const const_iterator&) = default;
+    const_iterator& operator=(const_iterator&&) = default;
+    ~const_iterator() noexcept                  = default;
+
+    bool operator!=(const const_iterator& rhs) const noexcept;
+
+    /// @brief Keys are decoded on the fly, so dereferencing yields a pair by value
+    value_type      operator*() const noexcept;
+    const_iterator& operator++() noexcept;
+
+   private:
+    const ImmutableIntegerMap* p_map_;
+    size_type                  idx_;
+  };
+
+  /// @brief
+  /// @tparam _MapCompare Functor used for comparisons in a std::map
+  /// @tparam _Alloc Allocator of the std::map
+  /// @param input_map A populated std::map
+  template <typename _MapCompare, typename _Alloc>
+  explicit ImmutableIntegerMap(const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map);
+
+  /// @brief
+  /// @tparam _Hash Functor used for computing the hash in a std::unordered_map
+  /// @tparam _Pred Functor used for key equality in the std::unordered_map
+  /// @tparam _Alloc Allocator of the std::unordered_map
+  /// @param input_map A populated std::unordered_map
+  template <typename _Hash, typename _Pred, typename _Alloc>
+  explicit ImmutableIntegerMap(const std::unordered_map<key_type, mapped_type, _Hash, _Pred, _Alloc>& input_map);
+
+  ImmutableIntegerMap(const ImmutableIntegerMap&) = delete;
+  ImmutableIntegerMap(ImmutableIntegerMap&&)      = delete;
+  ImmutableIntegerMap& operator=(const ImmutableIntegerMap&) = delete;
+  ImmutableIntegerMap& operator=(ImmutableIntegerMap&&) = delete;
+
+  ~ImmutableIntegerMap() = default;
+
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  const_reference at(key_type key) const;
+  const_reference operator[](key_type key) const;
+
+  bool      empty() const noexcept;
+  size_type size() const noexcept;
+  size_type count(key_type key) const noexcept;
+
+ private:
+  /// Deltas are computed in the unsigned type so that signed keys work too
+  using unsigned_key_type = std::make_unsigned_t<key_type>;
+
+  static constexpr size_type kBitsPerWord = 64;
+
+  struct Block {
+    /// Index of the block's first word in packed_deltas_
+    size_type words_offset;
+
+    /// Number of bits used by each delta in the block
+    uint8_t bit_width;
+  };
+
+  /// A value on its own, so that a map of bools doesn't get the packed std::vector<bool>, which has no references to
+  /// hand out
+  struct Value {
+    mapped_type value;
+  };
+
+  using input_type = std::pair<const key_type, mapped_type>;
+
+  /// @brief Encodes the blocks and copies the values from input elements that are sorted by key
+  void Build(const std::vector<const input_type*>& sorted_input);
+
+  /// @return key - base, computed without signed overflow
+  static unsigned_key_type Delta(key_type key, key_type base) noexcept;
+
+  /// @return the delta of element idx_in_block from the base of block block_idx
+  unsigned_key_type DeltaAt(size_type block_idx, size_type idx_in_block) const noexcept;
+
+  key_type KeyAt(size_type idx) const noexcept;
+
+  /// @brief Finds the index of key
+  /// @return index of the element, or size() if the key is not in the map
+  size_type FindIndex(key_type key) const noexcept;
+
+  /// First key of every block
+  std::vector<key_type> block_bases_;
+
+  std::vector<Block> blocks_;
+
+  std::vector<uint64_t> packed_deltas_;
+
+  std::vector<Value> values_;
+};
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+template <typename _MapCompare, typename _Alloc>
+ImmutableIntegerMap<_Key, _Tp, _BlockSize>::ImmutableIntegerMap(
+    const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map) {
+  std::vector<const input_type*> sorted_input;
+  sorted_input.reserve(input_map.size());
+
+  for (const auto& value : input_map) {
+    sorted_input.push_back(&value);
+  }
+
+  if constexpr (!std::is_same<_MapCompare, std::less<key_type>>::value) {
+    std::sort(sorted_input.begin(), sorted_input.end(),
+              [](const input_type* lhs, const input_type* rhs) -> bool { return lhs->first < rhs->first; });
+  }
+
+  Build(sorted_input);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+template <typename _Hash, typename _Pred, typename _Alloc>
+ImmutableIntegerMap<_Key, _Tp, _BlockSize>::ImmutableIntegerMap(
+    const std::unordered_map<key_type, mapped_type, _Hash, _Pred, _Alloc>& input_map) {
+  std::vector<const input_type*> sorted_input;
+  sorted_input.reserve(input_map.size());
+
+  for (const auto& value : input_map) {
+    sorted_input.push_back(&value);
+  }
+
+  std::sort(sorted_input.begin(), sorted_input.end(),
+            [](const input_type* lhs, const input_type* rhs) -> bool { return lhs->first < rhs->first; });
+
+  Build(sorted_input);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::begin() const noexcept -> const_iterator {
+  return const_iterator(this, 0);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::end() const noexcept -> const_iterator {
+  return const_iterator(this, values_.size());
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::at(key_type key) const -> const_reference {
+  const auto idx = FindIndex(key);
+
+  if (idx == values_.size()) {
+    throw std::out_of_range("");
+  }
+
+  return values_[idx].value;
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::operator[](key_type key) const -> const_reference {
+  return this->at(key);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+bool ImmutableIntegerMap<_Key, _Tp, _BlockSize>::empty() const noexcept {
+  return values_.empty();
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::size() const noexcept -> size_type {
+  return values_.size();
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::count(key_type key) const noexcept -> size_type {
+  return static_cast<size_type>(FindIndex(key) != values_.size());
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+void ImmutableIntegerMap<_Key, _Tp, _BlockSize>::Build(const std::vector<const input_type*>& sorted_input) {
+  const auto num_blocks = (sorted_input.size() + _BlockSize - 1) / _BlockSize;
+
+  block_bases_.reserve(num_blocks);
+  blocks_.reserve(num_blocks);
+  values_.reserve(sorted_input.size());
+
+  for (size_type first = 0; first < sorted_input.size(); first += _BlockSize) {
+    const auto last = std::min(first + _BlockSize, sorted_input.size());
+    const auto base = sorted_input[first]->first;
+
+    // keys are sorted, so the last delta in the block is the largest one
+    const auto max_delta = Delta(sorted_input[last - 1]->first, base);
+
+    uint8_t bit_width = 0;
+    while (bit_width < sizeof(unsigned_key_type) * 8 && (max_delta >> bit_width) != 0) {
+      ++bit_width;
+    }
+
+    block_bases_.push_back(base);
+    blocks_.push_back(Block{packed_deltas_.size(), bit_width});
+
+    const auto num_bits = (last - first) * bit_width;
+    const auto offset   = packed_deltas_.size();
+    packed_deltas_.resize(offset + (num_bits + kBitsPerWord - 1) / kBitsPerWord, 0);
+
+    for (size_type idx = first; idx < last && bit_width != 0; ++idx) {
+      const uint64_t delta = Delta(sorted_input[idx]->first, base);
+      const auto     bit   = (idx - first) * bit_width;
+      const auto     word  = offset + bit / kBitsPerWord;
+      const auto     shift = bit % kBitsPerWord;
+
+      packed_deltas_[word] |= delta << shift;
+      if (shift + bit_width > kBitsPerWord) {
+        packed_deltas_[word + 1] |= delta >> (kBitsPerWord - shift);
+      }
+    }
+
+    for (size_type idx = first; idx < last; ++idx) {
+      values_.push_back(Value{sorted_input[idx]->second});
+    }
+  }
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::Delta(key_type key, key_type base) noexcept -> unsigned_key_type {
+  const unsigned_key_type unsigned_key  = key;
+  const unsigned_key_type unsigned_base = base;
+  return unsigned_key - unsigned_base;
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::DeltaAt(size_type block_idx, size_type idx_in_block) const noexcept
+    -> unsigned_key_type {
+  const auto& block = blocks_[block_idx];
+
+  if (block.bit_width == 0) {
+    return 0;
+  }
+
+  const auto bit   = idx_in_block * block.bit_width;
+  const auto word  = block.words_offset + bit / kBitsPerWord;
+  const auto shift = bit % kBitsPerWord;
+
+  uint64_t delta = packed_deltas_[word] >> shift;
+  if (shift + block.bit_width > kBitsPerWord) {
+    delta |= packed_deltas_[word + 1] << (kBitsPerWord - shift);
+  }
+
+  if (block.bit_width < kBitsPerWord) {
+    delta &= (uint64_t{1} << block.bit_width) - 1;
+  }
+
+  // the block was encoded from unsigned_key_type values, so this never truncates
+  const unsigned_key_type narrowed_delta = delta;
+  return narrowed_delta;
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::KeyAt(size_type idx) const noexcept -> key_type {
+  const auto block_idx = idx / _BlockSize;
+
+  const unsigned_key_type base = block_bases_[block_idx];
+  const unsigned_key_type key  = base + DeltaAt(block_idx, idx % _BlockSize);
+  return static_cast<key_type>(key);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::FindIndex(key_type key) const noexcept -> size_type {
+  // find the last block whose base is <= key
+  const auto block_iter = std::upper_bound(block_bases_.begin(), block_bases_.end(), key);
+  if (block_iter == block_bases_.begin()) {
+    return values_.size();
+  }
+
+  const auto block_idx = static_cast<size_type>(block_iter - block_bases_.begin()) - 1;
+  const auto delta     = Delta(key, *(block_iter - 1));
+
+  // deltas within a block are strictly increasing
+  size_type lo = 0;
+  size_type hi = std::min(_BlockSize, values_.size() - block_idx * _BlockSize);
+
+  while (lo != hi) {
+    const auto mid       = (lo + hi) / 2;
+    const auto mid_delta = DeltaAt(block_idx, mid);
+
+    if (mid_delta == delta) {
+      return block_idx * _BlockSize + mid;
+    }
+
+    if (delta < mid_delta) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return values_.size();
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+ImmutableIntegerMap<_Key, _Tp, _BlockSize>::const_iterator::const_iterator(const ImmutableIntegerMap* p_map,
+                                                                           size_type                  idx) noexcept
+    : p_map_(p_map), idx_(idx) {}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+bool ImmutableIntegerMap<_Key, _Tp, _BlockSize>::const_iterator::operator!=(const const_iterator& rhs) const noexcept {
+  return this->idx_ != rhs.idx_ || this->p_map_ != rhs.p_map_;
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::const_iterator::operator*() const noexcept -> value_type {
+  return value_type(p_map_->KeyAt(idx_), p_map_->values_[idx_].value);
+}
+
+template <typename _Key, typename _Tp, size_t _BlockSize>
+auto ImmutableIntegerMap<_Key, _Tp, _BlockSize>::const_iterator::operator++() noexcept -> const_iterator& {
+  ++idx_;
+  return *this;
+}
+
+}  // namespace helpers::containers
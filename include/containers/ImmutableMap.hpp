@@ -3,26 +3,49 @@
 #include <algorithm>
 #include <functional>
 #include <map>
+#include <stdexcept>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "MembershipFilter.hpp"
+#include "SearchIndex.hpp"
+
 namespace helpers::containers {
 
+/// @brief Tag for constructing an ImmutableMap from values that are already sorted and have unique keys
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
 /// @brief ImmutableMap is an ordered associative container (ie stores key/value pairs) that cannot be modified.
 /// Constructed from either a std::map or std::unordered_map that have already been populated
+/// When _Compare defines is_transparent (eg std::less<>), lookups accept any type comparable with _Key
 /// @tparam _Key key type
 /// @tparam _Tp value type
 /// @tparam _Compare functor to use for comparison
-template <typename _Key, typename _Tp, typename _Compare = std::less<_Key>>
+/// @tparam _Filter approximate membership filter built with the map and checked by count() before searching, so most
+/// misses skip the search (eg BlockedBloomFilter<_Key>); the default filter does nothing
+/// @tparam _Index index built with the map that narrows the range searched by lookups (eg PiecewiseLinearIndex<_Key>
+/// for numeric keys); the default index searches the whole map
+template <typename _Key, typename _Tp, typename _Compare = std::less<_Key>, typename _Filter = NoMembershipFilter<_Key>,
+          typename _Index = NoSearchIndex<_Key>>
 class ImmutableMap {
  public:
   using key_type        = _Key;
   using mapped_type     = _Tp;
   using key_compare     = _Compare;
+  using filter_type     = _Filter;
+  using index_type      = _Index;
   using value_type      = std::pair<_Key, _Tp>;
   using size_type       = size_t;
   using const_reference = const mapped_type&;
 
+  static_assert(detail::kFilterAgreesWithCompare<_Filter, _Compare>,
+                "the filter's hash doesn't agree with the comparator; give the filter a hasher that does");
+
   class const_iterator {
    public:
     explicit const_iterator(const value_type* v) noexcept;
@@ -44,15 +67,22 @@ class ImmutableMap {
 
   /// @brief
   /// @tparam _MapCompare Functor used for comparisons in a std::map
+  /// @tparam _Alloc Allocator of the std::map
   /// @param input_map A populated std::map
-  template <typename _MapCompare>
-  explicit ImmutableMap(const std::map<key_type, mapped_type, _MapCompare>& input_map);
+  template <typename _MapCompare, typename _Alloc>
+  explicit ImmutableMap(const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map);
 
   /// @brief
   /// @tparam _Hash Functor used for computing the has in a std::unordered_map
+  /// @tparam _Pred Functor used for key equality in the std::unordered_map
+  /// @tparam _Alloc Allocator of the std::unordered_map
   /// @param input_map A populated std::unordered_map
-  template <typename _Hash>
-  explicit ImmutableMap(const std::unordered_map<_Key, _Tp, _Hash>& input_map);
+  template <typename _Hash, typename _Pred, typename _Alloc>
+  explicit ImmutableMap(const std::unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc>& input_map);
+
+  /// @brief Takes ownership of values without sorting them
+  /// @param sorted_values values sorted by _Compare, with unique keys
+  ImmutableMap(sorted_unique_t, std::vector<value_type>&& sorted_values);
 
   ImmutableMap(const ImmutableMap&) = delete;
   ImmutableMap(ImmutableMap&&)      = delete;
@@ -67,49 +97,80 @@ class ImmutableMap {
   const_reference at(const key_type& key) const;
   const_reference operator[](const key_type& key) const;
 
+  /// @brief Heterogeneous lookup, only available when key_compare is transparent
+  /// The filter and the index only understand key_type, so they are bypassed
+  template <typename _K, typename _C = _Compare, typename = typename _C::is_transparent>
+  const_reference at(const _K& key) const;
+
+  template <typename _K, typename _C = _Compare, typename = typename _C::is_transparent>
+  const_reference operator[](const _K& key) const;
+
   bool      empty() const noexcept;
   size_type size() const noexcept;
   size_type count(const key_type& key) const noexcept;
 
- private:
-  /// @brief
-  /// @param
-  /// @param
-  /// @param
-  /// @return
-  /// @throw
-  const_reference FindElement(size_type lo, size_type hi, const key_type& key) const;
+  /// @brief Heterogeneous count, only available when key_compare is transparent
+  template <typename _K, typename _C = _Compare, typename = typename _C::is_transparent>
+  size_type count(const _K& key) const noexcept;
 
-  /// @brief
-  /// @param
-  /// @param
-  /// @param
-  /// @return
-  bool DoesElementExist(size_type lo, size_type hi, const key_type& key) const noexcept;
+ private:
+  /// @brief Searches [lo, hi) for the element that is equivalent to key
+  /// @param lo index of the first element to search
+  /// @param hi index one past the last element to search
+  /// @param key key to search for
+  /// @return reference to the mapped value
+  /// @throw std::out_of_range if the key is not in the map
+  template <typename _K>
+  const_reference FindElement(size_type lo, size_type hi, const _K& key) const;
+
+  /// @brief Checks if [lo, hi) contains an element that is equivalent to key
+  /// @param lo index of the first element to search
+  /// @param hi index one past the last element to search
+  /// @param key key to search for
+  /// @return true if the key is in the map
+  template <typename _K>
+  bool DoesElementExist(size_type lo, size_type hi, const _K& key) const noexcept;
+
+  /// @brief Finds the first element in [lo, hi) whose key does not compare less than key
+  /// Only uses comp_ so that keys don't need operator== and heterogeneous keys work
+  /// @return index of the element, or hi if every element is less than key
+  template <typename _K>
+  size_type LowerBound(size_type lo, size_type hi, const _K& key) const noexcept;
+
+  /// @brief Populates filter_ and index_ from map_
+  void BuildSearchStructures();
 
   _Compare comp_;
 
+  _Filter filter_;
+
+  _Index index_;
+
   std::vector<value_type> map_;
 };
 
-template <typename _Key, typename _Tp, typename _Compare>
-template <typename _MapCompare>
-ImmutableMap<_Key, _Tp, _Compare>::ImmutableMap(const std::map<key_type, mapped_type, _MapCompare>& input_map) {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _MapCompare, typename _Alloc>
+ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::ImmutableMap(
+    const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map) {
   map_.reserve(input_map.size());
 
   for (const auto& value : input_map) {
     map_.push_back(value);
   }
 
-  if constexpr (!std::is_same<key_compare, typename std::map<_Key, _Tp, _MapCompare>::key_compare>::value) {
+  if constexpr (!std::is_same<key_compare, typename std::map<_Key, _Tp, _MapCompare, _Alloc>::key_compare>::value) {
     std::sort(map_.begin(), map_.end(),
               [&](const value_type& lhs, const value_type& rhs) -> bool { return comp_(lhs.first, rhs.first); });
   }
+
+  BuildSearchStructures();
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-template <typename _Hash>
-ImmutableMap<_Key, _Tp, _Compare>::ImmutableMap(const std::unordered_map<_Key, _Tp, _Hash>& input_map) {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _Hash, typename _Pred, typename _Alloc>
+ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::ImmutableMap(
+    const std::unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc>& input_map) {
   map_.reserve(input_map.size());
 
   for (const auto& value : input_map) {
@@ -118,103 +179,151 @@ ImmutableMap<_Key, _Tp, _Compare>::ImmutableMap(const std::unordered_map<_Key, _
 
   std::sort(map_.begin(), map_.end(),
             [&](const value_type& lhs, const value_type& rhs) -> bool { return comp_(lhs.first, rhs.first); });
+
+  BuildSearchStructures();
+}
+
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::ImmutableMap(sorted_unique_t,
+                                                                 std::vector<value_type>&& sorted_values)
+    : map_(std::move(sorted_values)) {
+  BuildSearchStructures();
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::begin() const noexcept -> const_iterator {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::begin() const noexcept -> const_iterator {
   return const_iterator(map_.data());
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::end() const noexcept -> const_iterator {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::end() const noexcept -> const_iterator {
   return const_iterator(map_.data() + map_.size());
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::at(const key_type& key) const -> const_reference {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::at(const key_type& key) const -> const_reference {
+  const auto [lo, hi] = index_.search_bound(key, map_.size());
+
+  return FindElement(lo, hi, key);
+}
+
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::operator[](const key_type& key) const -> const_reference {
+  return this->at(key);
+}
+
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K, typename _C, typename>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::at(const _K& key) const -> const_reference {
   return FindElement(0, map_.size(), key);
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::operator[](const key_type& key) const -> const_reference {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K, typename _C, typename>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::operator[](const _K& key) const -> const_reference {
   return this->at(key);
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-bool ImmutableMap<_Key, _Tp, _Compare>::empty() const noexcept {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+bool ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::empty() const noexcept {
   return map_.empty();
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::size() const noexcept -> size_type {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::size() const noexcept -> size_type {
   return map_.size();
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::count(const key_type& key) const noexcept -> size_type {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::count(const key_type& key) const noexcept -> size_type {
+  if (!filter_.may_contain(key)) {
+    return 0;
+  }
+
+  const auto [lo, hi] = index_.search_bound(key, map_.size());
+
+  return static_cast<size_type>(DoesElementExist(lo, hi, key));
+}
+
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K, typename _C, typename>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::count(const _K& key) const noexcept -> size_type {
   return static_cast<size_type>(DoesElementExist(0, map_.size(), key));
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::FindElement(size_type lo, size_type hi, const key_type& key) const
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::FindElement(size_type lo, size_type hi, const _K& key) const
     -> const_reference {
-  if (hi == lo) {
+  const auto idx = LowerBound(lo, hi, key);
+
+  if (idx == hi || comp_(key, map_[idx].first)) {
     throw std::out_of_range("");
   }
 
-  const auto mid = (lo + hi) / 2;
+  return map_[idx].second;
+}
 
-  if (map_[mid].first == key) {
-    return map_[mid].second;
-  }
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K>
+bool ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::DoesElementExist(size_type lo, size_type hi,
+                                                                          const _K& key) const noexcept {
+  const auto idx = LowerBound(lo, hi, key);
 
-  if (comp_(key, map_[mid].first)) {
-    return FindElement(lo, mid, key);
-  } else {
-    return FindElement(mid + 1, hi, key);
-  }
+  return idx != hi && !comp_(key, map_[idx].first);
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-bool ImmutableMap<_Key, _Tp, _Compare>::DoesElementExist(size_type lo, size_type hi,
-                                                         const key_type& key) const noexcept {
-  if (hi == lo) {
-    return false;
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+template <typename _K>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::LowerBound(size_type lo, size_type hi,
+                                                                    const _K& key) const noexcept -> size_type {
+  while (lo != hi) {
+    const auto mid = (lo + hi) / 2;
+
+    if (comp_(map_[mid].first, key)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
   }
 
-  const auto mid = (lo + hi) / 2;
+  return lo;
+}
 
-  if (map_[mid].first == key) {
-    return true;
-  }
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+void ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::BuildSearchStructures() {
+  filter_.reserve(map_.size());
+  index_.reserve(map_.size());
 
-  if (comp_(key, map_[mid].first)) {
-    return DoesElementExist(lo, mid, key);
-  } else {
-    return DoesElementExist(mid + 1, hi, key);
+  for (const auto& value : map_) {
+    filter_.insert(value.first);
+    index_.insert(value.first);
   }
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-ImmutableMap<_Key, _Tp, _Compare>::const_iterator::const_iterator(const value_type* p_value) noexcept
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::const_iterator::const_iterator(const value_type* p_value) noexcept
     : p_value_(p_value) {}
 
-template <typename _Key, typename _Tp, typename _Compare>
-bool ImmutableMap<_Key, _Tp, _Compare>::const_iterator::operator!=(const const_iterator& rhs) const noexcept {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+bool ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::const_iterator::operator!=(
+    const const_iterator& rhs) const noexcept {
   return this->p_value_ != rhs.p_value_;
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::const_iterator::operator*() const noexcept -> const value_type& {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::const_iterator::operator*() const noexcept
+    -> const value_type& {
   return *p_value_;
 }
 
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::const_iterator::operator->() const noexcept -> const value_type* {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::const_iterator::operator->() const noexcept
+    -> const value_type* {
   return p_value_;
 }
-template <typename _Key, typename _Tp, typename _Compare>
-auto ImmutableMap<_Key, _Tp, _Compare>::const_iterator::operator++() noexcept -> const_iterator& {
+template <typename _Key, typename _Tp, typename _Compare, typename _Filter, typename _Index>
+auto ImmutableMap<_Key, _Tp, _Compare, _Filter, _Index>::const_iterator::operator++() noexcept -> const_iterator& {
   ++p_value_;
   return *this;
 }
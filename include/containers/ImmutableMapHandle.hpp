@@ -0,0 +1,207 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @brief Hands out small, dense ids to threads so that per-thread state can live in fixed size arrays
+/// An id is assigned the first time a thread asks for one and is recycled when that thread exits
+class ReaderThreadIds {
+ public:
+  static size_t Get() {
+    thread_local Registration registration;
+    return registration.id;
+  }
+
+ private:
+  struct Registration {
+    Registration() : id(Acquire()) {}
+    ~Registration() { Release(id); }
+
+    size_t id;
+  };
+
+  static size_t Acquire() {
+    std::unique_lock<std::mutex> mlock(mtx_);
+
+    if (free_ids_.empty()) {
+      return next_id_++;
+    }
+
+    const auto id = free_ids_.back();
+    free_ids_.pop_back();
+    return id;
+  }
+
+  static void Release(size_t id) {
+    std::unique_lock<std::mutex> mlock(mtx_);
+
+    free_ids_.push_back(id);
+  }
+
+  inline static std::mutex          mtx_;
+  inline static std::vector<size_t> free_ids_;
+  inline static size_t              next_id_ = 0;
+};
+
+}  // namespace detail
+
+/// @brief Publishes immutable maps to concurrent readers, RCU style
+/// Readers are wait-free: they record the current epoch in a cache line owned by their thread and load the map pointer,
+/// so they never write to memory shared with other readers. publish() swaps the pointer with a single atomic exchange,
+/// then waits until no reader that could have seen the old map is still active before deleting it.
+/// @tparam _Map map type, eg ImmutableMap<_Key, _Tp>
+/// @tparam _MaxReaderThreads maximum number of live threads that have ever called read(), on any handle of the
+/// process; a thread's reader id is only recycled when the thread exits
+template <typename _Map, size_t _MaxReaderThreads = 256>
+class ImmutableMapHandle {
+  struct ReaderSlot;
+
+ public:
+  using map_type = _Map;
+
+  /// @brief Keeps the map it refers to alive; must be destroyed by the thread that created it
+  /// Guards may nest on the same thread
+  class ReadGuard {
+   public:
+    ReadGuard(const ReadGuard&) = delete;
+    ReadGuard(ReadGuard&&)      = delete;
+    ReadGuard& operator=(const ReadGuard&) = delete;
+    ReadGuard& operator=(ReadGuard&&) = delete;
+
+    ~ReadGuard() noexcept;
+
+    const map_type& operator*() const noexcept;
+    const map_type* operator->() const noexcept;
+    const map_type* get() const noexcept;
+
+   private:
+    friend class ImmutableMapHandle;
+
+    ReadGuard(ReaderSlot& slot, const map_type* p_map) noexcept;
+
+    ReaderSlot&     slot_;
+    const map_type* p_map_;
+  };
+
+  explicit ImmutableMapHandle(std::unique_ptr<const map_type> p_map);
+
+  ImmutableMapHandle(const ImmutableMapHandle&) = delete;
+  ImmutableMapHandle(ImmutableMapHandle&&)      = delete;
+  ImmutableMapHandle& operator=(const ImmutableMapHandle&) = delete;
+  ImmutableMapHandle& operator=(ImmutableMapHandle&&) = delete;
+
+  /// @brief No ReadGuard may outlive the handle
+  ~ImmutableMapHandle();
+
+  /// @brief Pins the current map
+  /// @throw std::length_error if more than _MaxReaderThreads threads are reading at the same time
+  ReadGuard read() const;
+
+  /// @brief Atomically replaces the current map; readers that start afterwards see p_map
+  /// Blocks until every reader of the previous map has finished, then deletes it. Must not be called while the calling
+  /// thread holds a ReadGuard.
+  void publish(std::unique_ptr<const map_type> p_map);
+
+ private:
+  /// Each slot is only written by the thread that owns it, and sits on its own cache line
+  struct alignas(64) ReaderSlot {
+    /// Epoch observed when the outermost guard was created, 0 when the thread isn't reading
+    std::atomic<uint64_t> epoch{0};
+
+    /// Number of nested guards; only touched by the owning thread
+    uint32_t depth = 0;
+  };
+
+  std::atomic<const map_type*> p_current_;
+
+  /// Incremented by every publish(); starts at 1 so that 0 can mean "not reading"
+  std::atomic<uint64_t> epoch_{1};
+
+  /// Serializes writers
+  std::mutex publish_mtx_;
+
+  mutable std::array<ReaderSlot, _MaxReaderThreads> slots_;
+};
+
+template <typename _Map, size_t _MaxReaderThreads>
+ImmutableMapHandle<_Map, _MaxReaderThreads>::ImmutableMapHandle(std::unique_ptr<const map_type> p_map)
+    : p_current_(p_map.release()) {}
+
+template <typename _Map, size_t _MaxReaderThreads>
+ImmutableMapHandle<_Map, _MaxReaderThreads>::~ImmutableMapHandle() {
+  delete p_current_.load();
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+auto ImmutableMapHandle<_Map, _MaxReaderThreads>::read() const -> ReadGuard {
+  const auto thread_id = detail::ReaderThreadIds::Get();
+
+  if (thread_id >= _MaxReaderThreads) {
+    throw std::length_error("ImmutableMapHandle: too many reader threads");
+  }
+
+  auto& slot = slots_[thread_id];
+
+  // the epoch must be visible to publishers before the pointer is loaded, both are sequentially consistent
+  if (slot.depth++ == 0) {
+    slot.epoch.store(epoch_.load());
+  }
+
+  return ReadGuard(slot, p_current_.load());
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+void ImmutableMapHandle<_Map, _MaxReaderThreads>::publish(std::unique_ptr<const map_type> p_map) {
+  std::unique_lock<std::mutex> mlock(publish_mtx_);
+
+  const auto* p_old_map = p_current_.exchange(p_map.release());
+
+  // any reader that observes new_epoch (or later) loads its pointer after the exchange, so it can't see p_old_map
+  const auto new_epoch = epoch_.fetch_add(1) + 1;
+
+  for (const auto& slot : slots_) {
+    for (auto epoch = slot.epoch.load(); epoch != 0 && epoch < new_epoch; epoch = slot.epoch.load()) {
+      std::this_thread::yield();
+    }
+  }
+
+  delete p_old_map;
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+ImmutableMapHandle<_Map, _MaxReaderThreads>::ReadGuard::ReadGuard(ReaderSlot& slot, const map_type* p_map) noexcept
+    : slot_(slot), p_map_(p_map) {}
+
+template <typename _Map, size_t _MaxReaderThreads>
+ImmutableMapHandle<_Map, _MaxReaderThreads>::ReadGuard::~ReadGuard() noexcept {
+  if (--slot_.depth == 0) {
+    slot_.epoch.store(0);
+  }
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+auto ImmutableMapHandle<_Map, _MaxReaderThreads>::ReadGuard::operator*() const noexcept -> const map_type& {
+  return *p_map_;
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+auto ImmutableMapHandle<_Map, _MaxReaderThreads>::ReadGuard::operator->() const noexcept -> const map_type* {
+  return p_map_;
+}
+
+template <typename _Map, size_t _MaxReaderThreads>
+auto ImmutableMapHandle<_Map, _MaxReaderThreads>::ReadGuard::get() const noexcept -> const map_type* {
+  return p_map_;
+}
+
+}  // namespace helpers::containers
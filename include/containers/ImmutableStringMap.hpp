@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace helpers::containers {
+
+/// @brief ImmutableStringMap is an ImmutableMap specialized for std::string keys
+/// All keys are packed into a single contiguous arena and every entry stores the first 8 bytes of its key inline, so
+/// most comparisons during a search never leave the (small) entry array. Keys are ordered lexicographically by bytes,
+/// same as std::less<std::string>, and every lookup takes a std::string_view so it never allocates.
+/// @tparam _Tp value type
+template <typename _Tp>
+class ImmutableStringMap {
+ public:
+  using key_type        = std::string;
+  using mapped_type     = _Tp;
+  using value_type      = std::pair<std::string_view, const _Tp&>;
+  using size_type       = size_t;
+  using const_reference = const mapped_type&;
+
+  class const_iterator {
+   public:
+    const_iterator(const ImmutableStringMap* p_map, size_type idx) noexcept;
+    const_iterator(const const_iterator&) = default;
+    const_iterator(const_iterator&&)      = default;
+    const_iterator& operator=(const const_iterator&) = default;
+    const_iterator& operator=(const_iterator&&) = default;
+    ~const_iterator() noexcept                  = default;
+
+    bool operator!=(const const_iterator& rhs) const noexcept;
+
+    /// @brief Keys are not stored as std::string, so dereferencing yields a pair of views by value
+    value_type      operator*() const noexcept;
+    const_iterator& operator++() noexcept;
+
+   private:
+    const ImmutableStringMap* p_map_;
+    size_type                 idx_;
+  };
+
+  /// @brief
+  /// @tparam _MapCompare Functor used for comparisons in a std::map
+  /// @tparam _Alloc Allocator of the std::map
+  /// @param input_map A populated std::map
+  template <typename _MapCompare, typename _Alloc>
+  explicit ImmutableStringMap(const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map);
+
+  /// @brief
+  /// @tparam _Hash Functor used for computing the hash in a std::unordered_map
+  /// @tparam _Pred Functor used for key equality in the std::unordered_map
+  /// @tparam _Alloc Allocator of the std::unordered_map
+  /// @param input_map A populated std::unordered_map
+  template <typename _Hash, typename _Pred, typename _Alloc>
+  explicit ImmutableStringMap(const std::unordered_map<key_type, mapped_type, _Hash, _Pred, _Alloc>& input_map);
+
+  ImmutableStringMap(const ImmutableStringMap&) = delete;
+  ImmutableStringMap(ImmutableStringMap&&)      = delete;
+  ImmutableStringMap& operator=(const ImmutableStringMap&) = delete;
+  ImmutableStringMap& operator=(ImmutableStringMap&&) = delete;
+
+  ~ImmutableStringMap() = default;
+
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  const_reference at(std::string_view key) const;
+  const_reference operator[](std::string_view key) const;
+
+  bool      empty() const noexcept;
+  size_type size() const noexcept;
+  size_type count(std::string_view key) const noexcept;
+
+ private:
+  static constexpr size_type kPrefixLength = sizeof(uint64_t);
+
+  struct Entry {
+    /// First kPrefixLength bytes of the key, big endian and zero padded, so that comparing prefixes as integers gives
+    /// the same ordering as comparing the bytes
+    uint64_t prefix;
+
+    /// Location of the full key in arena_
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  /// Holds one value, so that values_ is never the packed std::vector<bool>, whose elements can't be returned by
+  /// reference
+  struct Value {
+    mapped_type value;
+  };
+
+  using input_type = std::pair<const key_type, mapped_type>;
+
+  /// @brief Fills the arena, the entry array and the values from input elements that are sorted by key
+  void Build(const std::vector<const input_type*>& sorted_input);
+
+  /// @brief Packs the first kPrefixLength bytes of key into an integer with the same ordering
+  static uint64_t LoadPrefix(std::string_view key) noexcept;
+
+  std::string_view KeyAt(size_type idx) const noexcept;
+
+  /// @brief Three-way comparison between the key stored at idx and key
+  /// @param idx index of the stored key
+  /// @param key key to compare against
+  /// @param key_prefix LoadPrefix(key), computed once per lookup
+  /// @return <0 if the stored key is less, 0 if equal, >0 if greater
+  int Compare(size_type idx, std::string_view key, uint64_t key_prefix) const noexcept;
+
+  /// @brief Finds the index of key
+  /// @return index of the element, or size() if the key is not in the map
+  size_type FindIndex(std::string_view key) const noexcept;
+
+  std::vector<Entry> entries_;
+
+  std::vector<Value> values_;
+
+  /// Every key, back to back, in sorted order
+  std::string arena_;
+};
+
+template <typename _Tp>
+template <typename _MapCompare, typename _Alloc>
+ImmutableStringMap<_Tp>::ImmutableStringMap(const std::map<key_type, mapped_type, _MapCompare, _Alloc>& input_map) {
+  std::vector<const input_type*> sorted_input;
+  sorted_input.reserve(input_map.size());
+
+  for (const auto& value : input_map) {
+    sorted_input.push_back(&value);
+  }
+
+  if constexpr (!std::is_same<_MapCompare, std::less<key_type>>::value &&
+                !std::is_same<_MapCompare, std::less<>>::value) {
+    std::sort(sorted_input.begin(), sorted_input.end(),
+              [](const input_type* lhs, const input_type* rhs) -> bool { return lhs->first < rhs->first; });
+  }
+
+  Build(sorted_input);
+}
+
+template <typename _Tp>
+template <typename _Hash, typename _Pred, typename _Alloc>
+ImmutableStringMap<_Tp>::ImmutableStringMap(
+    const std::unordered_map<key_type, mapped_type, _Hash, _Pred, _Alloc>& input_map) {
+  std::vector<const input_type*> sorted_input;
+  sorted_input.reserve(input_map.size());
+
+  for (const auto& value : input_map) {
+    sorted_input.push_back(&value);
+  }
+
+  std::sort(sorted_input.begin(), sorted_input.end(),
+            [](const input_type* lhs, const input_type* rhs) -> bool { return lhs->first < rhs->first; });
+
+  Build(sorted_input);
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::begin() const noexcept -> const_iterator {
+  return const_iterator(this, 0);
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::end() const noexcept -> const_iterator {
+  return const_iterator(this, entries_.size());
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::at(std::string_view key) const -> const_reference {
+  const auto idx = FindIndex(key);
+
+  if (idx == entries_.size()) {
+    throw std::out_of_range("");
+  }
+
+  return values_[idx].value;
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::operator[](std::string_view key) const -> const_reference {
+  return this->at(key);
+}
+
+template <typename _Tp>
+bool ImmutableStringMap<_Tp>::empty() const noexcept {
+  return entries_.empty();
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::size() const noexcept -> size_type {
+  return entries_.size();
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::count(std::string_view key) const noexcept -> size_type {
+  return static_cast<size_type>(FindIndex(key) != entries_.size());
+}
+
+template <typename _Tp>
+void ImmutableStringMap<_Tp>::Build(const std::vector<const input_type*>& sorted_input) {
+  size_type arena_size = 0;
+  for (const auto* p_value : sorted_input) {
+    arena_size += p_value->first.size();
+  }
+
+  if (arena_size > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("ImmutableStringMap keys exceed the maximum arena size");
+  }
+
+  arena_.reserve(arena_size);
+  entries_.reserve(sorted_input.size());
+  values_.reserve(sorted_input.size());
+
+  for (const auto* p_value : sorted_input) {
+    entries_.push_back(Entry{LoadPrefix(p_value->first), static_cast<uint32_t>(arena_.size()),
+                             static_cast<uint32_t>(p_value->first.size())});
+    arena_.append(p_value->first);
+    values_.push_back(Value{p_value->second});
+  }
+}
+
+template <typename _Tp>
+uint64_t ImmutableStringMap<_Tp>::LoadPrefix(std::string_view key) noexcept {
+  uint64_t prefix = 0;
+
+  for (size_type i = 0; i < kPrefixLength; ++i) {
+    const uint64_t byte = i < key.size() ? static_cast<unsigned char>(key[i]) : 0;
+    prefix              = (prefix << 8) | byte;
+  }
+
+  return prefix;
+}
+
+template <typename _Tp>
+std::string_view ImmutableStringMap<_Tp>::KeyAt(size_type idx) const noexcept {
+  return std::string_view(arena_.data() + entries_[idx].offset, entries_[idx].length);
+}
+
+template <typename _Tp>
+int ImmutableStringMap<_Tp>::Compare(size_type idx, std::string_view key, uint64_t key_prefix) const noexcept {
+  const auto& entry = entries_[idx];
+
+  if (entry.prefix != key_prefix) {
+    return entry.prefix < key_prefix ? -1 : 1;
+  }
+
+  // equal zero padded prefixes and one of the keys fits in the prefix means the shorter key is a prefix of the other
+  if (entry.length <= kPrefixLength || key.size() <= kPrefixLength) {
+    return entry.length == key.size() ? 0 : (entry.length < key.size() ? -1 : 1);
+  }
+
+  return KeyAt(idx).substr(kPrefixLength).compare(key.substr(kPrefixLength));
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::FindIndex(std::string_view key) const noexcept -> size_type {
+  const auto key_prefix = LoadPrefix(key);
+
+  size_type lo = 0;
+  size_type hi = entries_.size();
+
+  while (lo != hi) {
+    const auto mid    = (lo + hi) / 2;
+    const auto result = Compare(mid, key, key_prefix);
+
+    if (result == 0) {
+      return mid;
+    }
+
+    if (result > 0) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return entries_.size();
+}
+
+template <typename _Tp>
+ImmutableStringMap<_Tp>::const_iterator::const_iterator(const ImmutableStringMap* p_map, size_type idx) noexcept
+    : p_map_(p_map), idx_(idx) {}
+
+template <typename _Tp>
+bool ImmutableStringMap<_Tp>::const_iterator::operator!=(const const_iterator& rhs) const noexcept {
+  return this->idx_ != rhs.idx_ || this->p_map_ != rhs.p_map_;
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::const_iterator::operator*() const noexcept -> value_type {
+  return value_type(p_map_->KeyAt(idx_), p_map_->values_[idx_].value);
+}
+
+template <typename _Tp>
+auto ImmutableStringMap<_Tp>::const_iterator::operator++() noexcept -> const_iterator& {
+  ++idx_;
+  return *this;
+}
+
+}  // namespace helpers::containers
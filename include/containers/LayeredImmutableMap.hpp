@@ -0,0 +1,250 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ImmutableMap.hpp"
+
+namespace helpers::containers {
+
+/// @brief LayeredImmutableMap is an ImmutableMap base plus a small sorted delta of upserts and tombstones (LSM style)
+/// Lookups check the delta first and fall back to the base. merge() folds the delta into a new base with a single
+/// linear pass over both, so the cost of an update scales with the size of the change, not with the size of the map.
+/// merge() is const and the object is cheap to copy (the base is shared), so a merge can run in the background on a
+/// copy; rebase() then installs the merged base and drops only the delta entries the merge covered.
+/// @tparam _Key key type
+/// @tparam _Tp value type
+/// @tparam _Compare functor to use for comparison
+template <typename _Key, typename _Tp, typename _Compare = std::less<_Key>>
+class LayeredImmutableMap {
+ public:
+  using key_type        = _Key;
+  using mapped_type     = _Tp;
+  using key_compare     = _Compare;
+  using base_type       = ImmutableMap<_Key, _Tp, _Compare>;
+  using size_type       = size_t;
+  using const_reference = const mapped_type&;
+
+  /// @brief Result of merge(); pass it to rebase()
+  struct MergedBase {
+    std::shared_ptr<const base_type> base;
+
+    /// Every delta entry with a sequence number <= sequence is contained in base
+    uint64_t sequence;
+  };
+
+  /// @param base populated map, may be shared with other LayeredImmutableMaps
+  explicit LayeredImmutableMap(std::shared_ptr<const base_type> base);
+
+  LayeredImmutableMap(const LayeredImmutableMap&) = default;
+  LayeredImmutableMap(LayeredImmutableMap&&)      = default;
+  LayeredImmutableMap& operator=(const LayeredImmutableMap&) = default;
+  LayeredImmutableMap& operator=(LayeredImmutableMap&&) = default;
+
+  ~LayeredImmutableMap() = default;
+
+  const_reference at(const key_type& key) const;
+  const_reference operator[](const key_type& key) const;
+
+  size_type count(const key_type& key) const noexcept;
+
+  /// @brief O(delta_size() * log(size())), the delta doesn't know which of its keys are in the base
+  size_type size() const noexcept;
+  bool      empty() const noexcept;
+
+  /// @brief Inserts key, or replaces its value if it already exists
+  void insert_or_assign(const key_type& key, mapped_type value);
+
+  /// @brief Removes key if it exists
+  void erase(const key_type& key);
+
+  /// @return number of upserts and tombstones that haven't been merged into the base yet
+  size_type delta_size() const noexcept;
+
+  const std::shared_ptr<const base_type>& base() const noexcept;
+
+  /// @brief Builds a new base that contains the current base with the delta applied
+  MergedBase merge() const;
+
+  /// @brief Replaces the base with the result of merge(), keeping only the changes made after that merge started
+  /// A merge that isn't newer than the current base is ignored: the delta entries it covers may already have been
+  /// dropped by a later merge, whose base it would roll back.
+  /// @param merged result of merge() called on this map, or on a copy of it
+  /// @return false if merged was ignored
+  bool rebase(const MergedBase& merged);
+
+ private:
+  struct DeltaEntry {
+    /// std::nullopt marks a tombstone
+    std::optional<mapped_type> value;
+
+    /// Order in which the change was made, used by rebase()
+    uint64_t sequence;
+  };
+
+  _Compare comp_;
+
+  std::shared_ptr<const base_type> base_;
+
+  std::map<key_type, DeltaEntry, key_compare> delta_;
+
+  /// Sequence number of the most recent change
+  uint64_t last_sequence_ = 0;
+
+  /// Sequence number of the last change contained in base_
+  uint64_t base_sequence_ = 0;
+};
+
+template <typename _Key, typename _Tp, typename _Compare>
+LayeredImmutableMap<_Key, _Tp, _Compare>::LayeredImmutableMap(std::shared_ptr<const base_type> base)
+    : base_(std::move(base)) {
+  if (!base_) {
+    throw std::invalid_argument("LayeredImmutableMap requires a base map");
+  }
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::at(const key_type& key) const -> const_reference {
+  const auto delta_iter = delta_.find(key);
+
+  if (delta_iter == delta_.end()) {
+    return base_->at(key);
+  }
+
+  if (!delta_iter->second.value) {
+    throw std::out_of_range("");
+  }
+
+  return *delta_iter->second.value;
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::operator[](const key_type& key) const -> const_reference {
+  return this->at(key);
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::count(const key_type& key) const noexcept -> size_type {
+  const auto delta_iter = delta_.find(key);
+
+  if (delta_iter == delta_.end()) {
+    return base_->count(key);
+  }
+
+  return static_cast<size_type>(delta_iter->second.value.has_value());
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::size() const noexcept -> size_type {
+  auto num_elements = base_->size();
+
+  for (const auto& [key, entry] : delta_) {
+    const auto in_base = base_->count(key) != 0;
+
+    if (entry.value && !in_base) {
+      ++num_elements;
+    } else if (!entry.value && in_base) {
+      --num_elements;
+    }
+  }
+
+  return num_elements;
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+bool LayeredImmutableMap<_Key, _Tp, _Compare>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+void LayeredImmutableMap<_Key, _Tp, _Compare>::insert_or_assign(const key_type& key, mapped_type value) {
+  delta_.insert_or_assign(key, DeltaEntry{std::move(value), ++last_sequence_});
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+void LayeredImmutableMap<_Key, _Tp, _Compare>::erase(const key_type& key) {
+  if (delta_.count(key) == 0 && base_->count(key) == 0) {
+    return;
+  }
+
+  // a pending upsert is replaced with a tombstone rather than dropped, because a merge that is already running may
+  // have picked up that upsert
+  delta_.insert_or_assign(key, DeltaEntry{std::nullopt, ++last_sequence_});
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::delta_size() const noexcept -> size_type {
+  return delta_.size();
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::base() const noexcept -> const std::shared_ptr<const base_type>& {
+  return base_;
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+auto LayeredImmutableMap<_Key, _Tp, _Compare>::merge() const -> MergedBase {
+  std::vector<typename base_type::value_type> merged_values;
+  merged_values.reserve(base_->size() + delta_.size());
+
+  auto       base_iter  = base_->begin();
+  const auto base_end   = base_->end();
+  auto       delta_iter = delta_.begin();
+
+  // both sides are sorted by comp_, so a single merge pass keeps the output sorted
+  while (base_iter != base_end || delta_iter != delta_.end()) {
+    const auto take_base = delta_iter == delta_.end() ||
+                           (base_iter != base_end && comp_(base_iter->first, delta_iter->first));
+    const auto same_key  = !take_base && base_iter != base_end && !comp_(delta_iter->first, base_iter->first);
+
+    if (take_base) {
+      merged_values.push_back(*base_iter);
+      ++base_iter;
+      continue;
+    }
+
+    if (delta_iter->second.value) {
+      merged_values.emplace_back(delta_iter->first, *delta_iter->second.value);
+    }
+
+    // the delta entry overrides the base element with the same key
+    if (same_key) {
+      ++base_iter;
+    }
+    ++delta_iter;
+  }
+
+  return MergedBase{std::make_shared<const base_type>(sorted_unique, std::move(merged_values)), last_sequence_};
+}
+
+template <typename _Key, typename _Tp, typename _Compare>
+bool LayeredImmutableMap<_Key, _Tp, _Compare>::rebase(const MergedBase& merged) {
+  if (!merged.base) {
+    throw std::invalid_argument("LayeredImmutableMap requires a base map");
+  }
+
+  if (merged.sequence <= base_sequence_) {
+    return false;
+  }
+
+  base_          = merged.base;
+  base_sequence_ = merged.sequence;
+
+  for (auto delta_iter = delta_.begin(); delta_iter != delta_.end();) {
+    if (delta_iter->second.sequence <= merged.sequence) {
+      delta_iter = delta_.erase(delta_iter);
+    } else {
+      ++delta_iter;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace helpers::containers
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "Vector2DExpression.hpp"
+#include "Vector2DLayout.hpp"
+#include "Vector2DView.hpp"
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @brief Header at the start of a MappedVector2D file, followed by the rows, one after the other, in native byte
+/// order
+struct MappedVector2DHeader {
+    static constexpr char     kMagic[8] = {'V', 'E', 'C', 'T', 'O', 'R', '2', 'D'};
+    static constexpr uint32_t kVersion  = 1;
+
+    char     magic[8];
+    uint32_t version;
+
+    /// MappedElementType of the elements, and their size
+    uint32_t element_type;
+    uint32_t element_size;
+    uint32_t reserved;
+
+    uint64_t rows;
+    uint64_t columns;
+
+    /// Offset of the first element from the start of the file
+    uint64_t data_offset;
+
+    /// Pads the header to a cache line, which aligns the elements that follow it
+    uint8_t padding[16];
+};
+
+static_assert(sizeof(MappedVector2DHeader) == 64);
+
+/// @return identifies arithmetic types by size, signedness and whether they're floating point; 0 for any other type,
+/// which is then only checked by size
+template <typename _Tp>
+constexpr uint32_t MappedElementType() noexcept {
+    if constexpr (std::is_arithmetic<_Tp>::value) {
+        return (std::is_floating_point<_Tp>::value ? 0x200U : 0U) | (std::is_signed<_Tp>::value ? 0x100U : 0U) |
+               static_cast<uint32_t>(sizeof(_Tp));
+    } else {
+        return 0;
+    }
+}
+
+/// @throw std::system_error holding errno
+[[noreturn]] inline void ThrowErrno(const char* what) { throw std::system_error(errno, std::generic_category(), what); }
+
+/// @brief Closes a file descriptor when it goes out of scope
+class FileDescriptor {
+  public:
+    explicit FileDescriptor(int fd) noexcept : fd_(fd) {}
+
+    FileDescriptor(const FileDescriptor&) = delete;
+
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    ~FileDescriptor() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    int get() const noexcept { return fd_; }
+
+  private:
+    int fd_;
+};
+
+/// @brief Maps a whole file, and unmaps it when it goes out of scope
+class FileMapping {
+  public:
+    FileMapping() noexcept = default;
+
+    /// @throw std::system_error if the file can't be mapped
+    FileMapping(int fd, size_t size, bool writable) : size_(size) {
+        p_data_ = ::mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+
+        if (p_data_ == MAP_FAILED) {
+            p_data_ = nullptr;
+            ThrowErrno("mmap");
+        }
+    }
+
+    FileMapping(FileMapping&& temp) noexcept
+        : p_data_(std::exchange(temp.p_data_, nullptr)), size_(std::exchange(temp.size_, 0)) {}
+
+    FileMapping& operator=(FileMapping&& temp) noexcept {
+        std::swap(p_data_, temp.p_data_);
+        std::swap(size_, temp.size_);
+        return *this;
+    }
+
+    ~FileMapping() {
+        if (p_data_ != nullptr) {
+            ::munmap(p_data_, size_);
+        }
+    }
+
+    void* data() const noexcept { return p_data_; }
+
+    size_t size() const noexcept { return size_; }
+
+  private:
+    void*  p_data_ = nullptr;
+    size_t size_   = 0;
+};
+
+}  // namespace detail
+
+/// @brief Row-major grid stored in a memory mapped file, for grids that don't fit in memory or that several processes
+/// share
+/// Opening maps the file without reading it; the OS reads pages as they're first accessed, and may drop them again
+/// under memory pressure. Writes through a writable mapping go to the file, and are seen by every process mapping it.
+/// The API follows Vector2D, minus resizing.
+/// @tparam _Tp element type, trivially copyable; const _Tp maps the file read-only
+template <typename _Tp>
+class MappedVector2D {
+  public:
+    using element_type = _Tp;
+    using value_type   = std::remove_const_t<_Tp>;
+    using layout_type  = RowMajorLayout;
+
+    static_assert(std::is_trivially_copyable<value_type>::value, "elements are stored as raw bytes");
+    static_assert(alignof(value_type) <= sizeof(detail::MappedVector2DHeader), "elements would be misaligned");
+
+    /// @brief How the elements will be accessed, so that the OS reads ahead, or not
+    enum class Access {
+        kNormal,
+        /// read ahead aggressively, and drop pages soon after they're accessed
+        kSequential,
+        /// don't read ahead
+        kRandom,
+    };
+
+    struct Dimensions {
+        size_t rows;
+        size_t columns;
+    };
+
+    using view_type = Vector2DView<_Tp, RowMajorLayout>;
+    using iterator  = typename view_type::iterator;
+
+    /// @brief Maps a file written by write_mapped_vector2d or create
+    /// @throw std::system_error if the file can't be opened or mapped
+    /// @throw std::invalid_argument if it isn't a grid of value_type
+    explicit MappedVector2D(const std::string& path, Access access = Access::kNormal)
+        : MappedVector2D(Map(path, std::is_const<_Tp>::value ? O_RDONLY : O_RDWR)) {
+        advise(access);
+    }
+
+    /// @brief Creates, or truncates, the file at path, and maps num_rows x num_columns zeroed elements
+    /// The file is sparse until the elements are written, so it can be larger than memory.
+    /// @throw std::system_error if the file can't be created or mapped
+    static MappedVector2D create(const std::string& path, size_t num_rows, size_t num_columns) {
+        static_assert(!std::is_const<_Tp>::value, "a new grid has to be writable");
+
+        constexpr size_t kHeaderSize = sizeof(detail::MappedVector2DHeader);
+        constexpr size_t kMaxFileSize = static_cast<size_t>(std::numeric_limits<off_t>::max());
+        if (num_columns != 0 && num_rows > (kMaxFileSize - kHeaderSize) / sizeof(value_type) / num_columns) {
+            throw std::invalid_argument("");
+        }
+
+        const detail::FileDescriptor file(::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+        if (file.get() < 0) {
+            detail::ThrowErrno("open");
+        }
+
+        const size_t file_size = kHeaderSize + num_rows * num_columns * sizeof(value_type);
+        if (::ftruncate(file.get(), static_cast<off_t>(file_size)) != 0) {
+            detail::ThrowErrno("ftruncate");
+        }
+
+        detail::FileMapping mapping(file.get(), file_size, true);
+
+        detail::MappedVector2DHeader header{};
+        std::memcpy(header.magic, detail::MappedVector2DHeader::kMagic, sizeof(header.magic));
+        header.version      = detail::MappedVector2DHeader::kVersion;
+        header.element_type = detail::MappedElementType<value_type>();
+        header.element_size = sizeof(value_type);
+        header.rows         = num_rows;
+        header.columns      = num_columns;
+        header.data_offset  = kHeaderSize;
+        std::memcpy(mapping.data(), &header, kHeaderSize);
+
+        return MappedVector2D(std::move(mapping));
+    }
+
+    MappedVector2D(const MappedVector2D&) = delete;
+
+    /// @brief Takes over the mapping; temp is left empty
+    MappedVector2D(MappedVector2D&& temp) noexcept
+        : mapping_(std::move(temp.mapping_)),
+          num_rows_(std::exchange(temp.num_rows_, 0)),
+          num_columns_(std::exchange(temp.num_columns_, 0)),
+          p_data_(std::exchange(temp.p_data_, nullptr)) {}
+
+    MappedVector2D& operator=(const MappedVector2D&) = delete;
+
+    /// @brief Unmaps the current grid and takes over the mapping of temp, which is left empty
+    MappedVector2D& operator=(MappedVector2D&& temp) noexcept {
+        if (this != &temp) {
+            // moving a mapping swaps it, so temp would otherwise keep the old grid mapped
+            mapping_      = std::move(temp.mapping_);
+            temp.mapping_ = detail::FileMapping();
+
+            num_rows_    = std::exchange(temp.num_rows_, 0);
+            num_columns_ = std::exchange(temp.num_columns_, 0);
+            p_data_      = std::exchange(temp.p_data_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~MappedVector2D() = default;
+
+    /// @brief Tells the OS how the whole grid will be accessed from now on
+    /// @throw std::system_error if the OS rejects the hint
+    void advise(Access access) {
+        constexpr int kAdvice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM};
+
+        Advise(mapping_.data(), mapping_.size(), kAdvice[static_cast<size_t>(access)]);
+    }
+
+    /// @brief Asks the OS to start reading rows [first_row, first_row + num_rows) in the background
+    /// @throw std::out_of_range if the rows are past the end
+    /// @throw std::system_error if the OS rejects the hint
+    void will_need(size_t first_row, size_t num_rows) {
+        if (first_row > num_rows_ || num_rows > num_rows_ - first_row) {
+            throw std::out_of_range("");
+        }
+
+        // madvise wants a page aligned address; the mapping itself starts on a page
+        const size_t page_size  = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t first_byte = sizeof(detail::MappedVector2DHeader) + first_row * num_columns_ * sizeof(value_type);
+        const size_t first_page = first_byte / page_size * page_size;
+        const size_t end_byte   = first_byte + num_rows * num_columns_ * sizeof(value_type);
+
+        Advise(static_cast<char*>(mapping_.data()) + first_page, end_byte - first_page, MADV_WILLNEED);
+    }
+
+    /// @brief Waits until the elements written so far are on disk; the OS writes them back eventually anyway
+    /// @throw std::system_error if they can't be written
+    void sync() {
+        static_assert(!std::is_const<_Tp>::value, "a read-only grid has nothing to write");
+
+        if (::msync(mapping_.data(), mapping_.size(), MS_SYNC) != 0) {
+            detail::ThrowErrno("msync");
+        }
+    }
+
+    Dimensions capacity() const noexcept { return Dimensions{num_rows_, num_columns_}; }
+
+    /// @brief Distance between the first elements of consecutive rows, in elements
+    size_t stride() const noexcept { return num_columns_; }
+
+    _Tp* data() const noexcept { return p_data_; }
+
+    /// @throw std::out_of_range if row or column is past the end
+    _Tp& at(size_t row, size_t column) const { return view().at(row, column); }
+
+    _Tp& operator()(size_t row, size_t column) const { return p_data_[row * num_columns_ + column]; }
+
+    iterator begin() const { return view().begin(); }
+
+    iterator end() const { return view().end(); }
+
+    view_type view() const noexcept { return view_type(p_data_, num_columns_, 0, 0, num_rows_, num_columns_); }
+
+    /// @return StridedSpan over the row
+    /// @throw std::out_of_range if row_idx is past the end
+    auto row(size_t row_idx) const { return view().row(row_idx); }
+
+    /// @return StridedSpan over the column
+    /// @throw std::out_of_range if column_idx is past the end
+    auto column(size_t column_idx) const { return view().column(column_idx); }
+
+    /// @brief View of num_rows x num_columns elements, starting at (first_row, first_column)
+    /// @throw std::out_of_range if the region doesn't fit in the grid
+    view_type subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) const {
+        return view().subview(first_row, first_column, num_rows, num_columns);
+    }
+
+  private:
+    /// @throw std::invalid_argument if the mapping doesn't hold a valid grid of value_type
+    explicit MappedVector2D(detail::FileMapping&& mapping) : mapping_(std::move(mapping)) {
+        detail::MappedVector2DHeader header;
+        if (mapping_.size() < sizeof(header)) {
+            throw std::invalid_argument("");
+        }
+
+        std::memcpy(&header, mapping_.data(), sizeof(header));
+
+        const size_t max_elements = (mapping_.size() - sizeof(header)) / sizeof(value_type);
+        if (std::memcmp(header.magic, detail::MappedVector2DHeader::kMagic, sizeof(header.magic)) != 0 ||
+            header.version != detail::MappedVector2DHeader::kVersion ||
+            header.element_type != detail::MappedElementType<value_type>() ||
+            header.element_size != sizeof(value_type) || header.data_offset != sizeof(header) ||
+            (header.columns != 0 && header.rows > max_elements / header.columns)) {
+            throw std::invalid_argument("");
+        }
+
+        num_rows_    = header.rows;
+        num_columns_ = header.columns;
+        p_data_      = reinterpret_cast<_Tp*>(static_cast<char*>(mapping_.data()) + header.data_offset);
+    }
+
+    /// @throw std::system_error if the file can't be opened or mapped
+    /// @throw std::invalid_argument if it's too small to hold a header
+    static detail::FileMapping Map(const std::string& path, int flags) {
+        const detail::FileDescriptor file(::open(path.c_str(), flags));
+        if (file.get() < 0) {
+            detail::ThrowErrno("open");
+        }
+
+        struct stat status;
+        if (::fstat(file.get(), &status) != 0) {
+            detail::ThrowErrno("fstat");
+        }
+
+        if (static_cast<size_t>(status.st_size) < sizeof(detail::MappedVector2DHeader)) {
+            throw std::invalid_argument("");
+        }
+
+        // the mapping outlives the descriptor
+        return detail::FileMapping(file.get(), static_cast<size_t>(status.st_size), flags != O_RDONLY);
+    }
+
+    static void Advise(void* p_first, size_t size, int advice) {
+        if (size != 0 && ::madvise(p_first, size, advice) != 0) {
+            detail::ThrowErrno("madvise");
+        }
+    }
+
+    detail::FileMapping mapping_;
+
+    size_t num_rows_    = 0;
+    size_t num_columns_ = 0;
+
+    /// First element, just after the header
+    _Tp* p_data_ = nullptr;
+};
+
+/// @brief Writes a Vector2D, view or expression to path, in the format MappedVector2D maps
+/// @throw std::system_error if the file can't be written
+template <typename _Operand, typename = std::enable_if_t<detail::kIsVector2DOperand<_Operand>>>
+void write_mapped_vector2d(const std::string& path, const _Operand& operand) {
+    const auto& expression = detail::AsExpression(operand);
+    using value_type       = typename std::decay_t<decltype(expression)>::value_type;
+
+    auto mapped = MappedVector2D<value_type>::create(path, expression.rows(), expression.columns());
+    mapped.advise(MappedVector2D<value_type>::Access::kSequential);
+
+    detail::Assign(mapped.view(), expression);
+}
+
+}  // namespace helpers::containers
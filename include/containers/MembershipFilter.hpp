@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace helpers::containers {
+
+/// @brief Membership filter that answers "maybe" for every key
+/// Default filter for ImmutableMap; compiles away entirely
+/// @tparam _Key key type
+template <typename _Key>
+class NoMembershipFilter {
+ public:
+  using key_type  = _Key;
+  using size_type = size_t;
+
+  void reserve(size_type) noexcept {}
+
+  void insert(const key_type&) noexcept {}
+
+  constexpr bool may_contain(const key_type&) const noexcept { return true; }
+};
+
+/// @brief Blocked Bloom filter; every key maps to a single 64 byte block, so a query touches one cache line
+/// May report false positives but never false negatives
+/// @tparam _Key key type
+/// @tparam _BitsPerKey number of filter bits per inserted key; more bits means fewer false positives
+/// (roughly 1% at 10 bits, 0.1% at 16 bits)
+/// @tparam _Hash functor used to hash keys; its output is remixed, so identity hashes (std::hash<int>) are fine
+/// In front of an ImmutableMap, keys that the map's comparator finds equivalent must hash the same, otherwise count()
+/// misses keys the map holds; std::hash only does so for comparators whose equivalence is ==, like std::less
+template <typename _Key, size_t _BitsPerKey = 10, typename _Hash = std::hash<_Key>>
+class BlockedBloomFilter {
+ public:
+  using key_type  = _Key;
+  using hasher    = _Hash;
+  using size_type = size_t;
+
+  static_assert(_BitsPerKey != 0);
+
+  BlockedBloomFilter() = default;
+
+  /// @brief Sizes the filter for num_keys keys and clears it; must be called before insert()
+  void reserve(size_type num_keys);
+
+  void insert(const key_type& key) noexcept;
+
+  /// @return false if key was definitely never inserted
+  bool may_contain(const key_type& key) const noexcept;
+
+  /// @return number of bits used by the filter
+  size_type bit_count() const noexcept;
+
+ private:
+  static constexpr size_type kWordsPerBlock = 8;
+  static constexpr size_type kBitsPerWord   = 64;
+  static constexpr size_type kBitsPerBlock  = kWordsPerBlock * kBitsPerWord;
+
+  /// Optimal number of probes for a Bloom filter is bits_per_key * ln(2)
+  static constexpr size_type kNumProbes = std::clamp<size_type>((_BitsPerKey * 693 + 500) / 1000, 1, 16);
+
+  struct alignas(64) Block {
+    std::array<uint64_t, kWordsPerBlock> words;
+  };
+
+  /// @brief murmur3 64 bit finalizer, spreads the entropy of the key's hash over every bit
+  static uint64_t Mix(uint64_t hash) noexcept;
+
+  size_type BlockIndex(uint64_t hash) const noexcept;
+
+  hasher hash_;
+
+  std::vector<Block> blocks_;
+};
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+void BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::reserve(size_type num_keys) {
+  const auto num_blocks = std::max<size_type>(1, (num_keys * _BitsPerKey + kBitsPerBlock - 1) / kBitsPerBlock);
+
+  blocks_.assign(num_blocks, Block{});
+}
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+void BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::insert(const key_type& key) noexcept {
+  const auto hash  = Mix(hash_(key));
+  auto&      block = blocks_[BlockIndex(hash)];
+
+  // double hashing within the block: probe i sets bit (h1 + i * h2) mod kBitsPerBlock
+  const auto h1 = static_cast<uint32_t>(hash);
+  const auto h2 = static_cast<uint32_t>(Mix(hash) >> 32) | 1;
+
+  for (size_type i = 0; i < kNumProbes; ++i) {
+    const auto bit = (h1 + i * h2) % kBitsPerBlock;
+    block.words[bit / kBitsPerWord] |= uint64_t{1} << (bit % kBitsPerWord);
+  }
+}
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+bool BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::may_contain(const key_type& key) const noexcept {
+  if (blocks_.empty()) {
+    return false;
+  }
+
+  const auto  hash  = Mix(hash_(key));
+  const auto& block = blocks_[BlockIndex(hash)];
+
+  const auto h1 = static_cast<uint32_t>(hash);
+  const auto h2 = static_cast<uint32_t>(Mix(hash) >> 32) | 1;
+
+  for (size_type i = 0; i < kNumProbes; ++i) {
+    const auto bit = (h1 + i * h2) % kBitsPerBlock;
+    if ((block.words[bit / kBitsPerWord] & (uint64_t{1} << (bit % kBitsPerWord))) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+auto BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::bit_count() const noexcept -> size_type {
+  return blocks_.size() * kBitsPerBlock;
+}
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+uint64_t BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::Mix(uint64_t hash) noexcept {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename _Key, size_t _BitsPerKey, typename _Hash>
+auto BlockedBloomFilter<_Key, _BitsPerKey, _Hash>::BlockIndex(uint64_t hash) const noexcept -> size_type {
+  // maps the upper 32 bits of the hash onto [0, num_blocks) without a division
+  return ((hash >> 32) * blocks_.size()) >> 32;
+}
+
+namespace detail {
+
+/// @brief true if every key that _Compare finds equivalent to an inserted key passes _Filter
+/// Filters that hash with std::hash<_Key> only agree with std::less and std::greater; a filter given its own hasher is
+/// trusted to agree with the comparator it's paired with.
+template <typename _Filter, typename _Compare>
+constexpr bool kFilterAgreesWithCompare = true;
+
+template <typename _Key, size_t _BitsPerKey, typename _Compare>
+constexpr bool kFilterAgreesWithCompare<BlockedBloomFilter<_Key, _BitsPerKey, std::hash<_Key>>, _Compare> =
+    std::is_same<_Compare, std::less<_Key>>::value || std::is_same<_Compare, std::less<>>::value ||
+    std::is_same<_Compare, std::greater<_Key>>::value || std::is_same<_Compare, std::greater<>>::value;
+
+}  // namespace detail
+
+}  // namespace helpers::containers
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @return num_threads, or the number of hardware threads if it's 0
+inline size_t ResolveNumThreads(size_t num_threads) noexcept {
+    if (num_threads != 0) {
+        return num_threads;
+    }
+
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/// @brief Number of blocks ParallelForBlocks splits num_items into
+inline size_t NumParallelBlocks(size_t num_items, size_t granularity, size_t num_threads) noexcept {
+    const size_t num_units = (num_items + granularity - 1) / granularity;
+
+    return std::min(ResolveNumThreads(num_threads), num_units);
+}
+
+/// @brief Splits [0, num_items) into contiguous blocks of about the same size, one per thread, and calls
+/// func(block_idx, first_item, end_item) for every block, each on its own thread
+/// The split only depends on the arguments, so two calls with the same arguments give every thread the same items;
+/// data initialized by one call is then local to the thread (and NUMA node) that processes it in the next.
+/// @param granularity block boundaries are multiples of it, eg so that tiles aren't shared between threads
+/// @param num_threads 0 for one thread per hardware thread
+/// @throw the first exception thrown by func, once every block is done
+/// @throw std::system_error if a thread can't be started, once the threads already started are done
+template <typename _Func>
+void ParallelForBlocks(size_t num_items, size_t granularity, size_t num_threads, const _Func& func) {
+    const size_t num_blocks = NumParallelBlocks(num_items, granularity, num_threads);
+    const size_t num_units  = (num_items + granularity - 1) / granularity;
+
+    std::vector<std::exception_ptr> exceptions(num_blocks);
+
+    auto run_block = [&](size_t block_idx) {
+        const size_t first_item = std::min(block_idx * num_units / num_blocks * granularity, num_items);
+        const size_t end_item   = std::min((block_idx + 1) * num_units / num_blocks * granularity, num_items);
+
+        try {
+            func(block_idx, first_item, end_item);
+        } catch (...) {
+            exceptions[block_idx] = std::current_exception();
+        }
+    };
+
+    /// Joins every started thread, also when starting the next one throws; destroying a joinable thread would
+    /// terminate the program, and the threads still refer to exceptions and run_block
+    struct ThreadJoiner {
+        ~ThreadJoiner() {
+            for (auto& thread : threads) {
+                if (thread.joinable()) {
+                    thread.join();
+                }
+            }
+        }
+
+        std::vector<std::thread> threads;
+    };
+
+    // the calling thread takes the first block instead of waiting
+    {
+        ThreadJoiner joiner;
+        joiner.threads.reserve(num_blocks);
+        for (size_t block_idx = 1; block_idx < num_blocks; ++block_idx) {
+            joiner.threads.emplace_back(run_block, block_idx);
+        }
+
+        if (num_blocks != 0) {
+            run_block(0);
+        }
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+}  // namespace detail
+
+}  // namespace helpers::containers
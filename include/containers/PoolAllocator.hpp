@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "ChunkedPool.hpp"
+#include "FixedPool.hpp"
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @brief Owns one pool per pool type, created the first time it is requested
+/// Containers rebind their allocator to internal node types, so a resource can't know up front which types it will
+/// have to serve
+class PoolRegistry {
+ public:
+  PoolRegistry() = default;
+
+  PoolRegistry(const PoolRegistry&) = delete;
+  PoolRegistry(PoolRegistry&&)      = delete;
+  PoolRegistry& operator=(const PoolRegistry&) = delete;
+  PoolRegistry& operator=(PoolRegistry&&) = delete;
+
+  ~PoolRegistry() = default;
+
+  template <typename _Pool>
+  _Pool& Get() {
+    for (const auto& entry : pools_) {
+      if (entry.p_tag == &kTag<_Pool>) {
+        return *static_cast<_Pool*>(entry.p_pool.get());
+      }
+    }
+
+    pools_.reserve(pools_.size() + 1);
+
+    auto p_pool = std::make_unique<_Pool>();
+    auto& pool  = *p_pool;
+    pools_.push_back(Entry{&kTag<_Pool>, PoolPointer(p_pool.release(), &Delete<_Pool>), &Capacity<_Pool>});
+    return pool;
+  }
+
+  /// @return sum of the capacities of every pool created so far
+  size_t Capacity() const noexcept {
+    size_t num_slots = 0;
+    for (const auto& entry : pools_) {
+      num_slots += entry.p_capacity(entry.p_pool.get());
+    }
+
+    return num_slots;
+  }
+
+ private:
+  using PoolPointer = std::unique_ptr<void, void (*)(void*)>;
+
+  struct Entry {
+    const void* p_tag;
+    PoolPointer p_pool;
+    size_t (*p_capacity)(const void*) noexcept;
+  };
+
+  /// Only the address matters; every pool type gets its own
+  template <typename _Pool>
+  inline static const char kTag = 0;
+
+  template <typename _Pool>
+  static void Delete(void* p_pool) {
+    delete static_cast<_Pool*>(p_pool);
+  }
+
+  template <typename _Pool>
+  static size_t Capacity(const void* p_pool) noexcept {
+    return static_cast<const _Pool*>(p_pool)->capacity();
+  }
+
+  // a handful of node types per resource, so a linear search is fastest
+  std::vector<Entry> pools_;
+};
+
+}  // namespace detail
+
+/// @brief Serves every type allocated through it from its own ChunkedPool; never runs out, only grows
+/// Not thread safe. Must outlive every container that allocates from it.
+/// @tparam _SlotsPerChunk number of slots added each time one of the pools grows
+template <size_t _SlotsPerChunk = 64>
+class ChunkedPoolResource {
+ public:
+  template <typename _Tp>
+  using pool_type = ChunkedPool<_Tp, _SlotsPerChunk>;
+
+  template <typename _Tp>
+  pool_type<_Tp>& pool() {
+    return registry_.Get<pool_type<_Tp>>();
+  }
+
+  /// @return number of slots in every pool created so far
+  size_t capacity() const noexcept { return registry_.Capacity(); }
+
+ private:
+  detail::PoolRegistry registry_;
+};
+
+/// @brief Serves every type allocated through it from its own FixedPool of _N slots
+/// Not thread safe. Must outlive every container that allocates from it.
+/// @tparam _N maximum number of objects of each type
+template <size_t _N>
+class FixedPoolResource {
+ public:
+  template <typename _Tp>
+  using pool_type = FixedPool<_Tp, _N>;
+
+  template <typename _Tp>
+  pool_type<_Tp>& pool() {
+    return registry_.Get<pool_type<_Tp>>();
+  }
+
+  /// @return number of slots in every pool created so far
+  size_t capacity() const noexcept { return registry_.Capacity(); }
+
+ private:
+  detail::PoolRegistry registry_;
+};
+
+/// @brief Standard allocator that takes single objects from the pools of a resource, eg the nodes of std::map,
+/// std::list or std::unordered_map
+/// Requests for more than one object (eg unordered_map's bucket array) fall back to std::allocator.
+/// @tparam _Tp type of the objects to allocate
+/// @tparam _Resource ChunkedPoolResource or FixedPoolResource
+template <typename _Tp, typename _Resource>
+class PoolAllocator {
+ public:
+  using value_type = _Tp;
+  using size_type  = size_t;
+
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap            = std::true_type;
+
+  explicit PoolAllocator(_Resource& resource) noexcept;
+
+  template <typename _Up>
+  PoolAllocator(const PoolAllocator<_Up, _Resource>& other) noexcept;
+
+  /// @throw std::bad_alloc if the pool is out of slots
+  _Tp* allocate(size_type num_objects);
+
+  void deallocate(_Tp* p, size_type num_objects) noexcept;
+
+  _Resource& resource() const noexcept;
+
+  template <typename _Up>
+  bool operator==(const PoolAllocator<_Up, _Resource>& rhs) const noexcept;
+
+  template <typename _Up>
+  bool operator!=(const PoolAllocator<_Up, _Resource>& rhs) const noexcept;
+
+ private:
+  template <typename _Up, typename _OtherResource>
+  friend class PoolAllocator;
+
+  using pool_type = typename _Resource::template pool_type<_Tp>;
+
+  /// @brief Looks the pool up on first use; many allocators are only ever rebound, never used
+  pool_type& Pool();
+
+  _Resource* p_resource_;
+
+  pool_type* p_pool_ = nullptr;
+};
+
+template <typename _Tp, typename _Resource>
+PoolAllocator<_Tp, _Resource>::PoolAllocator(_Resource& resource) noexcept : p_resource_(&resource) {}
+
+template <typename _Tp, typename _Resource>
+template <typename _Up>
+PoolAllocator<_Tp, _Resource>::PoolAllocator(const PoolAllocator<_Up, _Resource>& other) noexcept
+    : p_resource_(other.p_resource_) {}
+
+template <typename _Tp, typename _Resource>
+_Tp* PoolAllocator<_Tp, _Resource>::allocate(size_type num_objects) {
+  if (num_objects != 1) {
+    return std::allocator<_Tp>().allocate(num_objects);
+  }
+
+  auto* p = Pool().allocate();
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return p;
+}
+
+template <typename _Tp, typename _Resource>
+void PoolAllocator<_Tp, _Resource>::deallocate(_Tp* p, size_type num_objects) noexcept {
+  if (num_objects != 1) {
+    std::allocator<_Tp>().deallocate(p, num_objects);
+    return;
+  }
+
+  // the pool already exists, it allocated p
+  Pool().deallocate(p);
+}
+
+template <typename _Tp, typename _Resource>
+_Resource& PoolAllocator<_Tp, _Resource>::resource() const noexcept {
+  return *p_resource_;
+}
+
+template <typename _Tp, typename _Resource>
+template <typename _Up>
+bool PoolAllocator<_Tp, _Resource>::operator==(const PoolAllocator<_Up, _Resource>& rhs) const noexcept {
+  return p_resource_ == rhs.p_resource_;
+}
+
+template <typename _Tp, typename _Resource>
+template <typename _Up>
+bool PoolAllocator<_Tp, _Resource>::operator!=(const PoolAllocator<_Up, _Resource>& rhs) const noexcept {
+  return !(*this == rhs);
+}
+
+template <typename _Tp, typename _Resource>
+auto PoolAllocator<_Tp, _Resource>::Pool() -> pool_type& {
+  if (p_pool_ == nullptr) {
+    p_pool_ = &p_resource_->template pool<_Tp>();
+  }
+
+  return *p_pool_;
+}
+
+}  // namespace helpers::containers
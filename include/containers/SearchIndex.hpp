@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace helpers::containers {
+
+/// @brief Search index that doesn't narrow the search at all
+/// Default index for ImmutableMap; compiles away entirely
+/// @tparam _Key key type
+template <typename _Key>
+class NoSearchIndex {
+ public:
+  using key_type  = _Key;
+  using size_type = size_t;
+
+  void reserve(size_type) noexcept {}
+
+  void insert(const key_type&) noexcept {}
+
+  std::pair<size_type, size_type> search_bound(const key_type&, size_type size) const noexcept { return {0, size}; }
+};
+
+/// @brief Learned index that models key -> position with a piecewise linear function (PGM / FITing-tree style)
+/// Keys are inserted in sorted order and segments are fitted on the fly with the shrinking cone algorithm, so that the
+/// position predicted for every inserted key is within _Epsilon of its real position. A lookup binary searches the
+/// (few, cache resident) segment start keys and returns a window of about 2 * _Epsilon positions around the prediction.
+/// If keys are not inserted in strictly increasing order (eg a map ordered with std::greater) the index disables
+/// itself and always returns the whole range.
+/// @tparam _Key arithmetic key type
+/// @tparam _Epsilon maximum prediction error, in positions; smaller means more segments and smaller search windows
+template <typename _Key, size_t _Epsilon = 32>
+class PiecewiseLinearIndex {
+ public:
+  using key_type  = _Key;
+  using size_type = size_t;
+
+  static_assert(std::is_arithmetic<_Key>::value, "PiecewiseLinearIndex requires an arithmetic key type");
+
+  PiecewiseLinearIndex() = default;
+
+  /// @brief Clears the index and reserves space for num_keys keys
+  void reserve(size_type num_keys);
+
+  /// @brief Appends the key stored at the next position; keys must be inserted in increasing order
+  void insert(const key_type& key);
+
+  /// @brief Narrows the range of positions that can contain key
+  /// @param key key to search for
+  /// @param size number of keys in the indexed container
+  /// @return [lo, hi) range of positions; if key is in the container, its position is in that range
+  std::pair<size_type, size_type> search_bound(const key_type& key, size_type size) const noexcept;
+
+  /// @return number of linear segments in the model
+  size_type segment_count() const noexcept;
+
+ private:
+  struct Segment {
+    size_type first_position;
+    double    slope;
+  };
+
+  /// @return key - first_key as a double, computed without losing the precision of large integral keys
+  static double Distance(const key_type& key, const key_type& first_key) noexcept;
+
+  void StartSegment(const key_type& key);
+
+  /// First key of every segment, kept apart from the segments so the binary search over them is dense
+  std::vector<key_type> segment_keys_;
+
+  std::vector<Segment> segments_;
+
+  /// Number of keys inserted so far
+  size_type num_keys_ = 0;
+
+  /// Range of slopes that keeps every key of the last segment within _Epsilon; only used while inserting
+  double slope_lo_ = 0.0;
+  double slope_hi_ = std::numeric_limits<double>::infinity();
+
+  bool sorted_ = true;
+};
+
+template <typename _Key, size_t _Epsilon>
+void PiecewiseLinearIndex<_Key, _Epsilon>::reserve(size_type num_keys) {
+  segment_keys_.clear();
+  segments_.clear();
+  num_keys_ = 0;
+  sorted_   = true;
+
+  // a guess, the number of segments depends on the key distribution
+  segment_keys_.reserve(num_keys / (2 * _Epsilon + 1) + 1);
+  segments_.reserve(num_keys / (2 * _Epsilon + 1) + 1);
+}
+
+template <typename _Key, size_t _Epsilon>
+void PiecewiseLinearIndex<_Key, _Epsilon>::insert(const key_type& key) {
+  const auto position = num_keys_++;
+
+  if (!sorted_) {
+    return;
+  }
+
+  if (segments_.empty()) {
+    StartSegment(key);
+    return;
+  }
+
+  if (!(segment_keys_.back() < key)) {
+    sorted_ = false;
+    return;
+  }
+
+  const auto dx = Distance(key, segment_keys_.back());
+  const auto dy = static_cast<double>(position - segments_.back().first_position);
+
+  // a slope within [lo, hi] predicts this key's position within _Epsilon
+  const auto lo = std::max(slope_lo_, (dy - static_cast<double>(_Epsilon)) / dx);
+  const auto hi = std::min(slope_hi_, (dy + static_cast<double>(_Epsilon)) / dx);
+
+  if (lo > hi) {
+    StartSegment(key);
+    return;
+  }
+
+  slope_lo_              = lo;
+  slope_hi_              = hi;
+  segments_.back().slope = lo + (hi - lo) / 2.0;
+}
+
+template <typename _Key, size_t _Epsilon>
+auto PiecewiseLinearIndex<_Key, _Epsilon>::search_bound(const key_type& key, size_type size) const noexcept
+    -> std::pair<size_type, size_type> {
+  if (!sorted_ || segments_.empty() || size != num_keys_) {
+    return {0, size};
+  }
+
+  const auto segment_iter = std::upper_bound(segment_keys_.begin(), segment_keys_.end(), key);
+  if (segment_iter == segment_keys_.begin()) {
+    return {0, 0};
+  }
+
+  const auto  segment_idx = static_cast<size_type>(segment_iter - segment_keys_.begin()) - 1;
+  const auto& segment     = segments_[segment_idx];
+
+  // if key is in the container, it's located between this segment's first key and the next segment's first key
+  const auto first = static_cast<double>(segment.first_position);
+  const auto last  = static_cast<double>(segment_idx + 1 < segments_.size() ? segments_[segment_idx + 1].first_position
+                                                                           : num_keys_);
+
+  // one extra position on both sides absorbs floating point rounding
+  const auto predicted = first + segment.slope * Distance(key, *(segment_iter - 1));
+  const auto lo        = std::clamp(predicted - static_cast<double>(_Epsilon + 1), first, last);
+  const auto hi        = std::clamp(predicted + static_cast<double>(_Epsilon + 2), first, last);
+
+  return {static_cast<size_type>(lo), static_cast<size_type>(hi)};
+}
+
+template <typename _Key, size_t _Epsilon>
+auto PiecewiseLinearIndex<_Key, _Epsilon>::segment_count() const noexcept -> size_type {
+  return segments_.size();
+}
+
+template <typename _Key, size_t _Epsilon>
+double PiecewiseLinearIndex<_Key, _Epsilon>::Distance(const key_type& key, const key_type& first_key) noexcept {
+  if constexpr (std::is_integral<key_type>::value) {
+    using unsigned_key_type = std::make_unsigned_t<key_type>;
+
+    const unsigned_key_type unsigned_key       = key;
+    const unsigned_key_type unsigned_first_key = first_key;
+    const unsigned_key_type distance           = unsigned_key - unsigned_first_key;
+    return static_cast<double>(distance);
+  } else {
+    const double double_key       = key;
+    const double double_first_key = first_key;
+    return double_key - double_first_key;
+  }
+}
+
+template <typename _Key, size_t _Epsilon>
+void PiecewiseLinearIndex<_Key, _Epsilon>::StartSegment(const key_type& key) {
+  segment_keys_.push_back(key);
+  segments_.push_back(Segment{num_keys_ - 1, 0.0});
+
+  slope_lo_ = 0.0;
+  slope_hi_ = std::numeric_limits<double>::infinity();
+}
+
+}  // namespace helpers::containers
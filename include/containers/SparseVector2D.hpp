@@ -0,0 +1,299 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "StridedSpan.hpp"
+#include "Vector2D.hpp"
+
+namespace helpers::containers {
+
+namespace detail {
+
+/// @brief Heap array of a fixed number of values, the stored elements of a SparseVector2D
+/// std::vector<bool> packs its elements into bits, so it has no data() and no references to single elements; this array
+/// keeps every element as a _Tp, bool included, so that rows can be handed out as spans.
+template <typename _Tp>
+class SparseValues {
+  public:
+    SparseValues() noexcept = default;
+
+    /// @brief Constructs element idx from value_at(idx)
+    template <typename _Func>
+    SparseValues(size_t size, _Func value_at) : p_values_(std::allocator<_Tp>().allocate(size)), size_(size) {
+        size_t idx = 0;
+
+        try {
+            for (; idx < size; ++idx) {
+                ::new (static_cast<void*>(p_values_ + idx)) _Tp(value_at(idx));
+            }
+        } catch (...) {
+            Release(p_values_, idx, size);
+            throw;
+        }
+    }
+
+    SparseValues(const SparseValues& other)
+        : SparseValues(other.size_, [&other](size_t idx) -> const _Tp& { return other.p_values_[idx]; }) {}
+
+    SparseValues(SparseValues&& temp) noexcept
+        : p_values_(std::exchange(temp.p_values_, nullptr)), size_(std::exchange(temp.size_, 0)) {}
+
+    SparseValues& operator=(const SparseValues& other) {
+        SparseValues copy(other);
+        return *this = std::move(copy);
+    }
+
+    SparseValues& operator=(SparseValues&& temp) noexcept {
+        std::swap(p_values_, temp.p_values_);
+        std::swap(size_, temp.size_);
+        return *this;
+    }
+
+    ~SparseValues() { Release(p_values_, size_, size_); }
+
+    size_t size() const noexcept { return size_; }
+
+    const _Tp* data() const noexcept { return p_values_; }
+
+    const _Tp& operator[](size_t idx) const noexcept { return p_values_[idx]; }
+
+  private:
+    /// @brief Destroys the first num_constructed values and frees the array
+    static void Release(_Tp* p_values, size_t num_constructed, size_t size) noexcept {
+        if (p_values != nullptr) {
+            std::destroy_n(p_values, num_constructed);
+            std::allocator<_Tp>().deallocate(p_values, size);
+        }
+    }
+
+    _Tp*   p_values_ = nullptr;
+    size_t size_     = 0;
+};
+
+}  // namespace detail
+
+/// @brief 2D array where most elements have the same default value, which only stores the other ones
+/// Elements are kept in compressed sparse row (CSR) form: for every row, the columns of its stored elements in
+/// increasing order, and their values. Memory grows with the number of stored elements, plus one offset per row,
+/// rather than with rows * columns. Reading an element takes a binary search in its row; visiting the stored elements
+/// of a row is a walk over two arrays.
+/// The CSR form is read-only; SparseVector2D::Builder collects elements in any order and builds it.
+/// @tparam _Tp element type
+/// @tparam _Index type of the stored column indices; the narrower, the less memory per stored element
+template <typename _Tp, typename _Index = uint32_t>
+class SparseVector2D {
+  public:
+    using value_type = _Tp;
+    using index_type = _Index;
+
+    struct Dimensions {
+        size_t rows;
+        size_t columns;
+    };
+
+    /// @brief Stored elements of a row, in increasing column order; columns[i] is the column of values[i]
+    struct Row {
+        size_t size() const noexcept { return values.size(); }
+
+        bool empty() const noexcept { return values.empty(); }
+
+        StridedSpan<const _Index> columns;
+        StridedSpan<const _Tp>    values;
+    };
+
+    /// @brief Collects elements as (row, column, value) triplets, in any order (COO form), and sorts them into a
+    /// SparseVector2D
+    class Builder;
+
+    /// @brief num_rows x num_columns elements, all default_value
+    /// @throw std::invalid_argument if _Index can't hold every column
+    SparseVector2D(size_t num_rows, size_t num_columns, const _Tp& default_value = _Tp())
+        : num_rows_(num_rows),
+          num_columns_(num_columns),
+          default_value_(default_value),
+          row_offsets_(num_rows + 1, 0) {
+        CheckColumns(num_columns);
+    }
+
+    Dimensions capacity() const noexcept { return Dimensions{num_rows_, num_columns_}; }
+
+    /// @brief Number of elements actually stored
+    size_t num_stored() const noexcept { return values_.size(); }
+
+    /// @brief Value of every element that isn't stored
+    const _Tp& default_value() const noexcept { return default_value_; }
+
+    /// @return the stored element at (row, column), or the default value
+    /// @throw std::out_of_range if row or column is past the end
+    const _Tp& at(size_t row, size_t column) const {
+        if (row >= num_rows_ || column >= num_columns_) {
+            throw std::out_of_range("");
+        }
+
+        return (*this)(row, column);
+    }
+
+    /// @return the stored element at (row, column), or the default value
+    const _Tp& operator()(size_t row, size_t column) const {
+        const size_t idx = Find(row, column);
+
+        return idx == npos ? default_value_ : values_[idx];
+    }
+
+    /// @return true if the element at (row, column) is stored, even if it equals the default value
+    bool contains(size_t row, size_t column) const noexcept {
+        return row < num_rows_ && column < num_columns_ && Find(row, column) != npos;
+    }
+
+    /// @brief Stored elements of the row
+    /// @throw std::out_of_range if row_idx is past the end
+    Row row(size_t row_idx) const {
+        if (row_idx >= num_rows_) {
+            throw std::out_of_range("");
+        }
+
+        const size_t first = row_offsets_[row_idx];
+        const size_t size  = row_offsets_[row_idx + 1] - first;
+
+        return Row{StridedSpan<const _Index>(column_indices_.data() + first, size, 1),
+                   StridedSpan<const _Tp>(values_.data() + first, size, 1)};
+    }
+
+    /// @brief Calls func(row, column, value) for every stored element, in row-major order
+    template <typename _Func>
+    void for_each(_Func func) const {
+        for (size_t row = 0; row < num_rows_; ++row) {
+            for (size_t idx = row_offsets_[row]; idx < row_offsets_[row + 1]; ++idx) {
+                func(row, size_t{column_indices_[idx]}, values_[idx]);
+            }
+        }
+    }
+
+    /// @brief Vector2D holding every element, stored or not
+    template <typename _Layout = RowMajorLayout>
+    Vector2D<_Tp, _Layout> to_dense() const {
+        Vector2D<_Tp, _Layout> dense(num_rows_, num_columns_, default_value_);
+
+        for_each([&dense](size_t row, size_t column, const _Tp& value) { dense(row, column) = value; });
+        return dense;
+    }
+
+  private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /// @throw std::invalid_argument if _Index can't hold every column
+    static void CheckColumns(size_t num_columns) {
+        if (num_columns != 0 && num_columns - 1 > std::numeric_limits<_Index>::max()) {
+            throw std::invalid_argument("");
+        }
+    }
+
+    /// @return position of the element at (row, column) in values_, or npos if it isn't stored
+    size_t Find(size_t row, size_t column) const noexcept {
+        const auto first = column_indices_.begin() + static_cast<std::ptrdiff_t>(row_offsets_[row]);
+        const auto last  = column_indices_.begin() + static_cast<std::ptrdiff_t>(row_offsets_[row + 1]);
+        const auto it    = std::lower_bound(first, last, column, [](_Index lhs, size_t rhs) { return lhs < rhs; });
+
+        return it != last && *it == column ? static_cast<size_t>(it - column_indices_.begin()) : npos;
+    }
+
+    size_t num_rows_    = 0;
+    size_t num_columns_ = 0;
+
+    _Tp default_value_;
+
+    /// Stored elements of row r are at [row_offsets_[r], row_offsets_[r + 1]) in column_indices_ and values_
+    std::vector<size_t> row_offsets_;
+    std::vector<_Index>       column_indices_;
+    detail::SparseValues<_Tp> values_;
+};
+
+template <typename _Tp, typename _Index>
+class SparseVector2D<_Tp, _Index>::Builder {
+  public:
+    /// @throw std::invalid_argument if _Index can't hold every column
+    Builder(size_t num_rows, size_t num_columns, const _Tp& default_value = _Tp())
+        : num_rows_(num_rows), num_columns_(num_columns), default_value_(default_value) {
+        CheckColumns(num_columns);
+    }
+
+    /// @brief Sets the element at (row, column); if it's set more than once, the last value wins
+    /// @throw std::out_of_range if row or column is past the end
+    void insert(size_t row, size_t column, const _Tp& value) {
+        if (row >= num_rows_ || column >= num_columns_) {
+            throw std::out_of_range("");
+        }
+
+        triplets_.push_back(Triplet{row, static_cast<_Index>(column), value});
+    }
+
+    void reserve(size_t num_elements) { triplets_.reserve(num_elements); }
+
+    /// @brief Number of elements inserted so far, counting repeated ones
+    size_t size() const noexcept { return triplets_.size(); }
+
+    /// @brief Sorts the elements inserted so far into a SparseVector2D, and empties the builder
+    SparseVector2D build() {
+        // stable, so that the last of the elements inserted at the same position comes last
+        std::stable_sort(triplets_.begin(), triplets_.end(), [](const Triplet& lhs, const Triplet& rhs) {
+            return lhs.row != rhs.row ? lhs.row < rhs.row : lhs.column < rhs.column;
+        });
+
+        // only the last of the elements at the same position is stored; the others are dropped in place
+        size_t num_stored = 0;
+        for (size_t idx = 0; idx < triplets_.size(); ++idx) {
+            if (idx + 1 < triplets_.size() && triplets_[idx + 1].row == triplets_[idx].row &&
+                triplets_[idx + 1].column == triplets_[idx].column) {
+                continue;
+            }
+
+            if (num_stored != idx) {
+                triplets_[num_stored] = std::move(triplets_[idx]);
+            }
+            ++num_stored;
+        }
+        triplets_.erase(triplets_.begin() + static_cast<std::ptrdiff_t>(num_stored), triplets_.end());
+
+        SparseVector2D vector(num_rows_, num_columns_, default_value_);
+        vector.column_indices_.reserve(num_stored);
+
+        for (const auto& triplet : triplets_) {
+            ++vector.row_offsets_[triplet.row + 1];
+            vector.column_indices_.push_back(triplet.column);
+        }
+
+        vector.values_ = detail::SparseValues<_Tp>(
+            num_stored, [this](size_t idx) -> _Tp&& { return std::move(triplets_[idx].value); });
+
+        // from the number of elements of every row to the offset of its first one
+        std::partial_sum(vector.row_offsets_.begin(), vector.row_offsets_.end(), vector.row_offsets_.begin());
+
+        triplets_.clear();
+        return vector;
+    }
+
+  private:
+    struct Triplet {
+        size_t row;
+        _Index column;
+        _Tp    value;
+    };
+
+    size_t num_rows_    = 0;
+    size_t num_columns_ = 0;
+
+    _Tp default_value_;
+
+    std::vector<Triplet> triplets_;
+};
+
+}  // namespace helpers::containers
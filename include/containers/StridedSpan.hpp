@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace helpers::containers {
+
+/// @brief Non-owning view of size elements, each stride elements after the previous one
+/// A row of a row-major Vector2D has a stride of 1, a column has a stride of the row length.
+/// @tparam _Tp element type; const _Tp for a read-only view
+template <typename _Tp>
+class StridedSpan {
+  public:
+    using element_type = _Tp;
+    using value_type   = std::remove_cv_t<_Tp>;
+    using size_type    = size_t;
+    using reference    = _Tp&;
+    using pointer      = _Tp*;
+
+    class iterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_cv_t<_Tp>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = _Tp*;
+        using reference         = _Tp&;
+
+        iterator() noexcept = default;
+
+        iterator(_Tp* p_first, size_t stride, difference_type idx) noexcept
+            : p_first_(p_first), stride_(stride), idx_(idx) {}
+
+        reference operator*() const { return p_first_[idx_ * stride_]; }
+
+        pointer operator->() const { return &**this; }
+
+        reference operator[](difference_type offset) const { return p_first_[(idx_ + offset) * stride_]; }
+
+        /// @brief prefix increment
+        iterator& operator++() noexcept {
+            ++idx_;
+            return *this;
+        }
+
+        /// @brief postfix increment
+        iterator operator++(int) noexcept {
+            iterator temp(*this);
+            ++idx_;
+            return temp;
+        }
+
+        iterator& operator--() noexcept {
+            --idx_;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept {
+            iterator temp(*this);
+            --idx_;
+            return temp;
+        }
+
+        iterator& operator+=(difference_type offset) noexcept {
+            idx_ += offset;
+            return *this;
+        }
+
+        iterator& operator-=(difference_type offset) noexcept {
+            idx_ -= offset;
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type offset) noexcept { return it += offset; }
+
+        friend iterator operator+(difference_type offset, iterator it) noexcept { return it += offset; }
+
+        friend iterator operator-(iterator it, difference_type offset) noexcept { return it -= offset; }
+
+        friend difference_type operator-(const iterator& lhs, const iterator& rhs) noexcept {
+            return lhs.idx_ - rhs.idx_;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ == rhs.idx_; }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ != rhs.idx_; }
+        friend bool operator<(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ < rhs.idx_; }
+        friend bool operator>(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ > rhs.idx_; }
+        friend bool operator<=(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ <= rhs.idx_; }
+        friend bool operator>=(const iterator& lhs, const iterator& rhs) noexcept { return lhs.idx_ >= rhs.idx_; }
+
+      private:
+        // the position is kept as an index, so that end() never points past the underlying array
+        _Tp*            p_first_ = nullptr;
+        size_t          stride_  = 0;
+        difference_type idx_     = 0;
+    };
+
+    StridedSpan() noexcept = default;
+
+    StridedSpan(_Tp* p_first, size_t size, size_t stride) noexcept : p_first_(p_first), size_(size), stride_(stride) {}
+
+    /// @brief A span of _Tp converts to a span of const _Tp
+    template <typename _Up, typename = std::enable_if_t<std::is_convertible<_Up (*)[], _Tp (*)[]>::value>>
+    StridedSpan(const StridedSpan<_Up>& other) noexcept
+        : p_first_(other.data()), size_(other.size()), stride_(other.stride()) {}
+
+    size_t size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Distance, in elements, between consecutive elements of the span
+    size_t stride() const noexcept { return stride_; }
+
+    /// @brief First element
+    _Tp* data() const noexcept { return p_first_; }
+
+    _Tp& operator[](size_t idx) const { return p_first_[idx * stride_]; }
+
+    /// @throw std::out_of_range if idx is past the end
+    _Tp& at(size_t idx) const {
+        if (idx >= size_) {
+            throw std::out_of_range("");
+        }
+
+        return (*this)[idx];
+    }
+
+    _Tp& front() const { return (*this)[0]; }
+
+    _Tp& back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() const noexcept { return iterator(p_first_, stride_, 0); }
+
+    iterator end() const noexcept { return iterator(p_first_, stride_, static_cast<std::ptrdiff_t>(size_)); }
+
+  private:
+    _Tp* p_first_ = nullptr;
+
+    size_t size_   = 0;
+    size_t stride_ = 1;
+};
+
+}  // namespace helpers::containers
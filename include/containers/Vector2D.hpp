@@ -1,160 +1,400 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "AlignedAllocator.hpp"
+#include "DefaultInitAllocator.hpp"
+#include "ParallelFor.hpp"
+#include "Vector2DExpression.hpp"
+#include "Vector2DLayout.hpp"
+#include "Vector2DView.hpp"
+
 namespace helpers::containers {
 
-template <typename _Tp>
+/// @brief Tag selecting the Vector2D constructor that initializes the elements from several threads
+struct ParallelFirstTouch {};
+
+inline constexpr ParallelFirstTouch parallel_first_touch{};
+
+/// @brief 2D array of elements stored in a single flat vector
+/// @tparam _Tp element type
+/// @tparam _Layout maps (row, column) to a position in the flat vector; RowMajorLayout, TiledLayout or
+/// PaddedRowMajorLayout
+template <typename _Tp, typename _Layout = RowMajorLayout>
 class Vector2D {
   public:
+    using value_type  = _Tp;
+    using layout_type = _Layout;
+
+    /// Over-aligned layouts get an allocator that honours their alignment
+    using allocator_type = std::conditional_t<(_Layout::kAlignment > alignof(_Tp)),
+                                              AlignedAllocator<_Tp, _Layout::kAlignment>, std::allocator<_Tp>>;
+
+    static_assert(_Layout::kAlignment == 0 || (_Layout::Offset(1, 0, 1) * sizeof(_Tp)) % _Layout::kAlignment == 0,
+                  "the layout doesn't keep rows of this element type aligned");
+
     struct Dimensions {
         size_t rows;
         size_t columns;
     };
 
-    class iterator {
-      public:
-        explicit iterator(typename std::vector<_Tp>::iterator&& iter) noexcept
-            : current_iterator_(std::move(iter)) {}
+    using view_type       = Vector2DView<_Tp, _Layout>;
+    using const_view_type = Vector2DView<const _Tp, _Layout>;
 
-        ~iterator() noexcept {}
+    /// Iterators visit the elements in row-major order, whatever the layout
+    using iterator       = typename view_type::iterator;
+    using const_iterator = typename const_view_type::iterator;
 
-        /// @brief postfix increment
-        iterator operator++(int) {
-            decltype(current_iterator_) temp(current_iterator_);
-            ++current_iterator_;
-            return temp;
-        }
+    Vector2D(size_t num_rows, size_t num_columns)
+        : capacity_rows_(num_rows),
+          capacity_columns_(num_columns),
+          num_rows_(num_rows),
+          num_columns_(num_columns),
+          array_(_Layout::StorageSize(num_rows, num_columns)) {
+        ValueInitialize(array_, 0);
+    }
+
+    Vector2D(size_t num_rows, size_t num_columns, const _Tp& default_value)
+        : capacity_rows_(num_rows),
+          capacity_columns_(num_columns),
+          num_rows_(num_rows),
+          num_columns_(num_columns),
+          array_(_Layout::StorageSize(num_rows, num_columns), default_value) {}
+
+    /// @brief Fills the vector with default_value from num_threads threads, each writing the rows that
+    /// parallel_for_rows, parallel_transform and parallel_reduce hand it for the same num_threads
+    /// Pages are mapped on the NUMA node of the thread that first writes them, so each thread of those algorithms then
+    /// works on memory local to it, rather than on whichever node the constructing thread ran on.
+    /// @param num_threads 0 for one thread per hardware thread
+    Vector2D(ParallelFirstTouch, size_t num_rows, size_t num_columns, const _Tp& default_value, size_t num_threads = 0)
+        : capacity_rows_(num_rows),
+          capacity_columns_(num_columns),
+          num_rows_(num_rows),
+          num_columns_(num_columns),
+          array_(_Layout::StorageSize(num_rows, num_columns)) {
+        static_assert(std::is_trivially_default_constructible<_Tp>::value,
+                      "allocating elements that aren't trivially default constructible already writes them");
+
+        detail::ParallelForBlocks(num_rows_, _Layout::kTileRows, num_threads,
+                                  [this, &default_value](size_t, size_t first_row, size_t end_row) {
+                                      std::fill(array_.begin() + RowBlockOffset(first_row),
+                                                array_.begin() + RowBlockOffset(end_row), default_value);
+                                  });
+    }
+
+    /// @brief Evaluates an element-wise expression, eg Vector2D<float> c = a * 2.0f + b
+    template <typename _Expr>
+    Vector2D(const Vector2DExpression<_Expr>& expression)
+        : Vector2D(expression.derived().rows(), expression.derived().columns()) {
+        detail::Assign(view(), expression.derived());
+    }
+
+    Vector2D(const Vector2D& other) = default;
+
+    Vector2D(Vector2D&& temp) noexcept = default;
 
-        /// @brief prefix increment
-        iterator& operator++() {
-            ++current_iterator_;
-            return *this;
+    ~Vector2D() = default;
+
+    Vector2D& operator=(const Vector2D& other) = default;
+
+    Vector2D& operator=(Vector2D&& temp) noexcept = default;
+
+    /// @brief Evaluates an element-wise expression in a single pass, resizing this vector to its dimensions first
+    /// The expression may refer to this vector, eg a = a * 2.0f + b
+    template <typename _Expr>
+    Vector2D& operator=(const Vector2DExpression<_Expr>& expression) {
+        const auto& derived = expression.derived();
+
+        if (derived.rows() != num_rows_ || derived.columns() != num_columns_) {
+            resize(derived.rows(), derived.columns());
         }
 
-        bool operator!=(const iterator& rhs) { return current_iterator_ != rhs.current_iterator_; }
+        detail::Assign(view(), derived);
+        return *this;
+    }
 
-        _Tp& operator*() { return *current_iterator_; }
+    /// @brief Element-wise compound assignment of a Vector2D, Vector2DView, expression or scalar
+    /// @throw std::invalid_argument if rhs is 2D and its dimensions differ from this vector's
+    template <typename _Rhs>
+    Vector2D& operator+=(const _Rhs& rhs) {
+        detail::Assign(view(), *this + rhs);
+        return *this;
+    }
 
-      private:
-        typename std::vector<_Tp>::iterator current_iterator_;
-    };
+    template <typename _Rhs>
+    Vector2D& operator-=(const _Rhs& rhs) {
+        detail::Assign(view(), *this - rhs);
+        return *this;
+    }
 
-    class const_iterator {
-      public:
-        explicit const_iterator(typename std::vector<_Tp>::const_iterator&& iter) noexcept
-            : current_iterator_(std::move(iter)) {}
+    template <typename _Rhs>
+    Vector2D& operator*=(const _Rhs& rhs) {
+        detail::Assign(view(), *this * rhs);
+        return *this;
+    }
 
-        ~const_iterator() noexcept {}
+    template <typename _Rhs>
+    Vector2D& operator/=(const _Rhs& rhs) {
+        detail::Assign(view(), *this / rhs);
+        return *this;
+    }
 
-        /// @brief postfix increment
-        const_iterator operator++(int) {
-            decltype(current_iterator_) temp(current_iterator_);
-            ++current_iterator_;
-            return temp;
+    /// @brief Changes the dimensions, keeping every element at its (row, column); elements that come into view are
+    /// value-initialized
+    /// Within the reserved dimensions nothing moves. Needing more rows extends the storage, like std::vector::resize;
+    /// needing more columns reallocates it and moves every element to its new position. The reallocation reserves at
+    /// least half as many columns again, so growing the columns one at a time only reallocates a logarithmic number
+    /// of times. Growing by half rather than doubling caps the unused columns, and the peak memory while the old and
+    /// new storage are both alive, for large grids.
+    void resize(size_t num_rows, size_t num_columns) {
+        if (num_columns > capacity_columns_) {
+            Reallocate(std::max(num_rows, capacity_rows_),
+                       std::max(num_columns, capacity_columns_ + capacity_columns_ / 2));
+        } else if (num_rows > capacity_rows_) {
+            ReserveRows(num_rows);
         }
 
-        /// @brief prefix increment
-        const_iterator& operator++() {
-            ++current_iterator_;
-            return *this;
+        // the storage outside the old dimensions may hold elements left there by an earlier shrink
+        ValueInitializeRegion(0, std::min(num_rows, num_rows_), num_columns_, num_columns);
+        ValueInitializeRegion(num_rows_, num_rows, 0, num_columns);
+
+        num_rows_    = num_rows;
+        num_columns_ = num_columns;
+    }
+
+    /// @brief Reinterprets the storage as num_rows x num_columns without moving any element, eg to see a 4 x 6 vector
+    /// as 2 x 12
+    /// Elements keep their row-major order if the layout is RowMajorLayout and no columns are reserved beyond the
+    /// current ones; otherwise each position takes whatever element is stored there. The storage only grows if the
+    /// new dimensions don't fit in it, and the reserved dimensions become the new ones.
+    void reshape(size_t num_rows, size_t num_columns) {
+        GrowStorage(_Layout::StorageSize(num_rows, num_columns));
+
+        capacity_rows_    = num_rows;
+        capacity_columns_ = num_columns;
+
+        num_rows_    = num_rows;
+        num_columns_ = num_columns;
+    }
+
+    /// @brief Lays the storage out for at least num_rows x num_columns, so that resizing up to that never reallocates
+    /// or moves an element; never shrinks
+    void reserve(size_t num_rows, size_t num_columns) {
+        if (num_columns > capacity_columns_) {
+            Reallocate(std::max(num_rows, capacity_rows_), num_columns);
+        } else if (num_rows > capacity_rows_) {
+            ReserveRows(num_rows);
         }
+    }
 
-        bool operator!=(const const_iterator& rhs) {
-            return current_iterator_ != rhs.current_iterator_;
+    /// @brief Releases the storage reserved beyond the current dimensions
+    void shrink_to_fit() {
+        if (capacity_rows_ != num_rows_ || capacity_columns_ != num_columns_ ||
+            array_.size() != _Layout::StorageSize(num_rows_, num_columns_)) {
+            Reallocate(num_rows_, num_columns_);
         }
+    }
 
-        const _Tp& operator*() { return *current_iterator_; }
+    /// @brief Dimensions the vector can be resized to without reallocating
+    Dimensions reserved() const noexcept { return Dimensions{capacity_rows_, capacity_columns_}; }
 
-      private:
-        typename std::vector<_Tp>::const_iterator current_iterator_;
-    };
+    Dimensions capacity() const noexcept { return Dimensions{num_rows_, num_columns_}; }
 
-    Vector2D(size_t num_rows, size_t num_columns)
-        : max_elements_(num_rows * num_columns),
-          num_rows_(num_rows),
-          num_columns_(num_columns),
-          num_elements_(max_elements_),
-          array_(max_elements_) {}
+    /// @brief Distance between the first elements of consecutive rows, in elements; only for layouts whose rows are
+    /// contiguous, where row r starts at data() + r * stride()
+    size_t stride() const noexcept {
+        static_assert(view_type::kStridedRows, "rows of this layout aren't evenly strided");
 
-    Vector2D(size_t num_rows, size_t num_columns, const _Tp& default_value)
-        : max_elements_(num_rows * num_columns),
-          num_rows_(num_rows),
-          num_columns_(num_columns),
-          num_elements_(max_elements_),
-          array_(max_elements_, default_value) {}
+        return _Layout::Offset(1, 0, capacity_columns_) - _Layout::Offset(0, 0, capacity_columns_);
+    }
 
-    Vector2D(const Vector2D& other) = default;
+    /// @brief First element of the storage, aligned to the layout's alignment
+    _Tp* data() noexcept { return array_.data(); }
 
-    Vector2D(Vector2D&& temp) noexcept = default;
+    const _Tp* data() const noexcept { return array_.data(); }
 
-    ~Vector2D() = default;
+    /// @throw std::out_of_range if row or column is past the end
+    _Tp& at(size_t row, size_t column) { return array_[FlattenDimensions(row, column)]; }
 
-    void resize(size_t num_rows, size_t num_columns) {
-        // for fast resizing, don't change the array size if only need to use a subset of its
-        // allocated memory
-        if (num_rows * num_columns <= max_elements_) {
-            num_rows_ = num_rows;
-            num_columns_ = num_columns;
+    const _Tp& at(size_t row, size_t column) const { return array_[FlattenDimensions(row, column)]; }
 
-            num_elements_ = num_rows * num_columns;
-        }
+    _Tp& operator()(size_t row, size_t column) { return array_[FlattenDimensions(row, column)]; }
+
+    const _Tp& operator()(size_t row, size_t column) const { return array_[FlattenDimensions(row, column)]; }
+
+    iterator begin() { return view().begin(); }
+
+    iterator end() { return view().end(); }
+
+    const_iterator begin() const { return view().begin(); }
+
+    const_iterator end() const { return view().end(); }
+
+    /// @brief View of every element; like every view, invalidated by a resize that reallocates
+    view_type view() noexcept { return view_type(array_.data(), capacity_columns_, 0, 0, num_rows_, num_columns_); }
+
+    const_view_type view() const noexcept {
+        return const_view_type(array_.data(), capacity_columns_, 0, 0, num_rows_, num_columns_);
+    }
+
+    /// @return StridedSpan over the row for row-major layouts, otherwise a one row view
+    /// @throw std::out_of_range if row_idx is past the end
+    auto row(size_t row_idx) { return view().row(row_idx); }
+
+    auto row(size_t row_idx) const { return view().row(row_idx); }
+
+    /// @return StridedSpan over the column for row-major layouts, otherwise a one column view
+    /// @throw std::out_of_range if column_idx is past the end
+    auto column(size_t column_idx) { return view().column(column_idx); }
+
+    auto column(size_t column_idx) const { return view().column(column_idx); }
+
+    /// @brief View of num_rows x num_columns elements, starting at (first_row, first_column)
+    /// @throw std::out_of_range if the region doesn't fit in the vector
+    view_type subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) {
+        return view().subview(first_row, first_column, num_rows, num_columns);
+    }
+
+    const_view_type subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) const {
+        return view().subview(first_row, first_column, num_rows, num_columns);
+    }
 
-        // need more elements than the array can support, it needs to be resized
-        else {
-            max_elements_ = num_rows * num_columns;
-            num_elements_ = max_elements_;
+    /// @brief Calls func(row, column, element) for every element, one tile after the other, in storage order
+    /// Visiting the elements the way they're laid out in memory is the fastest way to touch all of them
+    template <typename _Func>
+    void for_each_by_tile(_Func func) {
+        ForEachByTile(*this, func);
+    }
+
+    template <typename _Func>
+    void for_each_by_tile(_Func func) const {
+        ForEachByTile(*this, func);
+    }
 
-            num_rows_ = num_rows;
-            num_columns_ = num_columns;
+  private:
+    /// The storage allocator leaves trivial elements uninitialized, so that parallel_first_touch can write them from
+    /// the threads that will use them; everywhere else ValueInitialize() zeroes them. Other types are value-initialized
+    /// by the allocator as usual: default-initializing eg a struct with a std::string and an int would leave the int
+    /// indeterminate.
+    using storage_allocator_type = std::conditional_t<std::is_trivially_default_constructible<_Tp>::value,
+                                                      DefaultInitAllocator<allocator_type>, allocator_type>;
+
+    using storage_type = std::vector<_Tp, storage_allocator_type>;
+
+    /// @brief Value-initializes the elements of array from first_element to its end, which the storage allocator left
+    /// uninitialized if they're trivial
+    static void ValueInitialize(storage_type& array, size_t first_element) {
+        if constexpr (std::is_trivially_default_constructible<_Tp>::value) {
+            std::fill(array.begin() + static_cast<std::ptrdiff_t>(first_element), array.end(), _Tp());
+        }
+    }
 
-            array_.resize(max_elements_);
+    /// @brief Resets the elements of rows [first_row, end_row) and columns [first_column, end_column)
+    void ValueInitializeRegion(size_t first_row, size_t end_row, size_t first_column, size_t end_column) {
+        for (size_t row = first_row; row < end_row; ++row) {
+            for (size_t column = first_column; column < end_column; ++column) {
+                array_[_Layout::Offset(row, column, capacity_columns_)] = _Tp();
+            }
         }
     }
 
-    Dimensions capacity() const noexcept { return Dimensions{num_rows_, num_columns_}; }
+    /// @brief Extends the storage to at least storage_size elements; elements don't move, unless the underlying
+    /// std::vector reallocates
+    void GrowStorage(size_t storage_size) {
+        const size_t old_size = array_.size();
 
-    _Tp& at(size_t row, size_t column) { return array_.at(FlattenDimensions(row, column)); }
+        if (storage_size > old_size) {
+            array_.resize(storage_size);
+            ValueInitialize(array_, old_size);
+        }
+    }
 
-    const _Tp& at(size_t row, size_t column) const {
-        return array_.at(FlattenDimensions(row, column));
+    /// @brief Reserves more rows; since offsets only depend on the number of columns, the existing rows stay put
+    void ReserveRows(size_t capacity_rows) {
+        GrowStorage(_Layout::StorageSize(capacity_rows, capacity_columns_));
+        capacity_rows_ = capacity_rows;
     }
 
-    _Tp& operator()(size_t row, size_t column) { return array_.at(FlattenDimensions(row, column)); }
+    /// @brief Lays the elements out in new storage for capacity_rows x capacity_columns; elements outside of it are
+    /// dropped
+    void Reallocate(size_t capacity_rows, size_t capacity_columns) {
+        storage_type array(_Layout::StorageSize(capacity_rows, capacity_columns));
+        ValueInitialize(array, 0);
 
-    const _Tp& operator()(size_t row, size_t column) const {
-        return array_.at(FlattenDimensions(row, column));
+        const size_t num_rows    = std::min(num_rows_, capacity_rows);
+        const size_t num_columns = std::min(num_columns_, capacity_columns);
+
+        for (size_t row = 0; row < num_rows; ++row) {
+            for (size_t column = 0; column < num_columns; ++column) {
+                array[_Layout::Offset(row, column, capacity_columns)] =
+                    std::move(array_[_Layout::Offset(row, column, capacity_columns_)]);
+            }
+        }
+
+        array_.swap(array);
+
+        capacity_rows_    = capacity_rows;
+        capacity_columns_ = capacity_columns;
+    }
+
+    /// @brief Offset of the first element of row, which starts a block of rows, or the end of the storage
+    /// Blocks start on tile boundaries, where the rows before them fill the storage up to that offset
+    std::ptrdiff_t RowBlockOffset(size_t row) const noexcept {
+        return static_cast<std::ptrdiff_t>(row == num_rows_ ? array_.size()
+                                                            : _Layout::Offset(row, 0, capacity_columns_));
     }
 
-    iterator begin() { return iterator(array_.begin()); }
+    /// @throw std::out_of_range if row or column is past the end
+    size_t FlattenDimensions(size_t row, size_t column) const {
+        if (row >= num_rows_ || column >= num_columns_) {
+            throw std::out_of_range("");
+        }
 
-    iterator end() { return iterator(array_.end()); }
+        return _Layout::Offset(row, column, capacity_columns_);
+    }
 
-    const_iterator begin() const { return const_iterator(array_.cbegin()); }
+    template <typename _Self, typename _Func>
+    static void ForEachByTile(_Self& self, _Func& func) {
+        for (size_t first_row = 0; first_row < self.num_rows_; first_row += _Layout::kTileRows) {
+            const size_t end_row = std::min(first_row + _Layout::kTileRows, self.num_rows_);
 
-    const_iterator end() const { return const_iterator(array_.cend()); }
+            for (size_t first_column = 0; first_column < self.num_columns_;) {
+                const size_t end_column =
+                    first_column + std::min(_Layout::kTileColumns, self.num_columns_ - first_column);
 
-  private:
-    size_t FlattenDimensions(size_t row, size_t column) const noexcept {
-        size_t flat_index = (row * num_columns_) + column;
+                for (size_t row = first_row; row < end_row; ++row) {
+                    auto* p_element = &self.array_[_Layout::Offset(row, first_column, self.capacity_columns_)];
 
-        assert(flat_index < num_elements_);
+                    for (size_t column = first_column; column < end_column; ++column, ++p_element) {
+                        func(row, column, *p_element);
+                    }
+                }
 
-        return flat_index;
+                first_column = end_column;
+            }
+        }
     }
 
-    /// Maximum number of elements the array can store
-    size_t max_elements_ = 0;
+    /// Number of rows & columns the array is laid out for; resizing within them never moves an element
+    size_t capacity_rows_    = 0;
+    size_t capacity_columns_ = 0;
 
     /// Number of rows & columns used for storing data in the array
-    /// These can be <= the maximum number of rows & columns
-    size_t num_rows_ = 0;
+    /// These can be <= the reserved number of rows & columns
+    size_t num_rows_    = 0;
     size_t num_columns_ = 0;
 
-    /// Number elements the array is storing
-    size_t num_elements_ = 0;
-
-    std::vector<_Tp> array_;
+    storage_type array_;
 };
 
+/// @brief Vector2D whose rows are padded so that each one starts on an _Alignment byte boundary
+template <typename _Tp, size_t _Alignment = 64>
+using AlignedVector2D = Vector2D<_Tp, PaddedRowMajorLayout<_Tp, _Alignment>>;
+
 }  // namespace ctr
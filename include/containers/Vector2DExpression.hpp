@@ -0,0 +1,361 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vector2DLayout.hpp"
+#include "Vector2DView.hpp"
+
+namespace helpers::containers {
+
+/// @brief Base of every lazy element-wise expression over Vector2Ds and Vector2DViews
+/// a * k + b builds a tree of small expression objects; nothing is computed until the tree is assigned to a Vector2D,
+/// or reduced with sum(), min() or max(). Evaluation then makes a single pass over the rows, computing every element
+/// of a row in one tight loop with no temporaries. When the operands have contiguous rows (RowMajorLayout or
+/// PaddedRowMajorLayout), that loop only reads through plain pointers, so the compiler can vectorize it.
+/// Expressions refer to their operands, so they must be evaluated before the operands are destroyed or resized; don't
+/// keep them in variables declared with auto.
+/// @tparam _Derived the expression type (CRTP)
+template <typename _Derived>
+class Vector2DExpression {
+  public:
+    const _Derived& derived() const noexcept { return static_cast<const _Derived&>(*this); }
+};
+
+namespace detail {
+
+/// @brief Row accessor of a layout whose rows aren't contiguous; locates every element through the layout
+template <typename _Tp, typename _Layout>
+struct Vector2DViewRow {
+    _Tp& operator[](size_t column) const { return view(row, column); }
+
+    Vector2DView<_Tp, _Layout> view;
+    size_t                     row;
+};
+
+/// @return pointer to the first element of the row if rows are contiguous, otherwise a Vector2DViewRow
+template <typename _Tp, typename _Layout>
+auto RowOf(const Vector2DView<_Tp, _Layout>& view, size_t row) {
+    if constexpr (Vector2DView<_Tp, _Layout>::kStridedRows) {
+        return &view(row, 0);
+    } else {
+        return Vector2DViewRow<_Tp, _Layout>{view, row};
+    }
+}
+
+/// @brief Every element of a Vector2D or Vector2DView operand
+template <typename _Tp, typename _Layout>
+class Vector2DLeaf : public Vector2DExpression<Vector2DLeaf<_Tp, _Layout>> {
+  public:
+    using value_type = _Tp;
+
+    static constexpr bool kIsScalar = false;
+
+    explicit Vector2DLeaf(const Vector2DView<const _Tp, _Layout>& view) noexcept : view_(view) {}
+
+    size_t rows() const noexcept { return view_.dimensions().rows; }
+
+    size_t columns() const noexcept { return view_.dimensions().columns; }
+
+    auto Row(size_t row) const { return RowOf(view_, row); }
+
+  private:
+    Vector2DView<const _Tp, _Layout> view_;
+};
+
+/// @brief Scalar operand, eg k in a * k; the same value for every element
+template <typename _Tp>
+class Vector2DScalar : public Vector2DExpression<Vector2DScalar<_Tp>> {
+  public:
+    using value_type = _Tp;
+
+    static constexpr bool kIsScalar = true;
+
+    struct ScalarRow {
+        _Tp operator[](size_t) const noexcept { return value; }
+
+        _Tp value;
+    };
+
+    explicit Vector2DScalar(_Tp value) noexcept : value_(value) {}
+
+    ScalarRow Row(size_t) const noexcept { return ScalarRow{value_}; }
+
+  private:
+    _Tp value_;
+};
+
+template <typename _Operand, typename _Op>
+class Vector2DUnaryExpression : public Vector2DExpression<Vector2DUnaryExpression<_Operand, _Op>> {
+  public:
+    using value_type = std::decay_t<decltype(_Op()(std::declval<typename _Operand::value_type>()))>;
+
+    static constexpr bool kIsScalar = false;
+
+    explicit Vector2DUnaryExpression(const _Operand& operand) : operand_(operand) {}
+
+    size_t rows() const noexcept { return operand_.rows(); }
+
+    size_t columns() const noexcept { return operand_.columns(); }
+
+    auto Row(size_t row) const {
+        struct UnaryRow {
+            auto operator[](size_t column) const { return _Op()(operand[column]); }
+
+            decltype(std::declval<const _Operand&>().Row(0)) operand;
+        };
+
+        return UnaryRow{operand_.Row(row)};
+    }
+
+  private:
+    _Operand operand_;
+};
+
+template <typename _Lhs, typename _Rhs, typename _Op>
+class Vector2DBinaryExpression : public Vector2DExpression<Vector2DBinaryExpression<_Lhs, _Rhs, _Op>> {
+  public:
+    using value_type = std::decay_t<decltype(
+        _Op()(std::declval<typename _Lhs::value_type>(), std::declval<typename _Rhs::value_type>()))>;
+
+    static constexpr bool kIsScalar = false;
+
+    /// @throw std::invalid_argument if both operands are 2D and their dimensions differ
+    Vector2DBinaryExpression(const _Lhs& lhs, const _Rhs& rhs) : lhs_(lhs), rhs_(rhs) {
+        if constexpr (!_Lhs::kIsScalar && !_Rhs::kIsScalar) {
+            if (lhs_.rows() != rhs_.rows() || lhs_.columns() != rhs_.columns()) {
+                throw std::invalid_argument("");
+            }
+        }
+    }
+
+    size_t rows() const noexcept {
+        if constexpr (_Lhs::kIsScalar) {
+            return rhs_.rows();
+        } else {
+            return lhs_.rows();
+        }
+    }
+
+    size_t columns() const noexcept {
+        if constexpr (_Lhs::kIsScalar) {
+            return rhs_.columns();
+        } else {
+            return lhs_.columns();
+        }
+    }
+
+    auto Row(size_t row) const {
+        struct BinaryRow {
+            auto operator[](size_t column) const { return _Op()(lhs[column], rhs[column]); }
+
+            decltype(std::declval<const _Lhs&>().Row(0)) lhs;
+            decltype(std::declval<const _Rhs&>().Row(0)) rhs;
+        };
+
+        return BinaryRow{lhs_.Row(row), rhs_.Row(row)};
+    }
+
+  private:
+    _Lhs lhs_;
+    _Rhs rhs_;
+};
+
+template <typename _Tp>
+struct IsVector2DView : std::false_type {};
+
+template <typename _Tp, typename _Layout>
+struct IsVector2DView<Vector2DView<_Tp, _Layout>> : std::true_type {};
+
+/// @brief Vector2DView, or a container whose const view() returns one, eg Vector2D, FixedVector2D or MappedVector2D
+/// Containers are recognized by that member rather than listed here, so expressions don't depend on any of them
+template <typename _Tp, typename = void>
+struct IsVector2DContainer : IsVector2DView<_Tp> {};
+
+template <typename _Tp>
+struct IsVector2DContainer<_Tp, std::void_t<decltype(std::declval<const _Tp&>().view())>>
+    : IsVector2DView<decltype(std::declval<const _Tp&>().view())> {};
+
+/// @brief Vector2D or another container with a view(), Vector2DView or expression
+template <typename _Tp>
+constexpr bool kIsVector2DOperand =
+    IsVector2DContainer<_Tp>::value || std::is_base_of<Vector2DExpression<_Tp>, _Tp>::value;
+
+template <typename _Lhs, typename _Rhs>
+constexpr bool kIsVector2DBinaryOperands =
+    (kIsVector2DOperand<_Lhs> && (kIsVector2DOperand<_Rhs> || std::is_arithmetic<_Rhs>::value)) ||
+    (std::is_arithmetic<_Lhs>::value && kIsVector2DOperand<_Rhs>);
+
+template <typename _Tp, typename _Layout>
+auto AsExpression(const Vector2DView<_Tp, _Layout>& view) {
+    return Vector2DLeaf<std::remove_const_t<_Tp>, _Layout>(view);
+}
+
+template <typename _Container, typename = std::enable_if_t<IsVector2DContainer<_Container>::value &&
+                                                           !IsVector2DView<_Container>::value>>
+auto AsExpression(const _Container& container) {
+    return AsExpression(container.view());
+}
+
+template <typename _Derived>
+const _Derived& AsExpression(const Vector2DExpression<_Derived>& expression) {
+    return expression.derived();
+}
+
+template <typename _Tp, typename = std::enable_if_t<std::is_arithmetic<_Tp>::value>>
+Vector2DScalar<_Tp> AsExpression(_Tp value) {
+    return Vector2DScalar<_Tp>(value);
+}
+
+template <typename _Op, typename _Lhs, typename _Rhs>
+auto MakeBinaryExpression(const _Lhs& lhs, const _Rhs& rhs) {
+    using lhs_type = std::decay_t<decltype(AsExpression(lhs))>;
+    using rhs_type = std::decay_t<decltype(AsExpression(rhs))>;
+
+    return Vector2DBinaryExpression<lhs_type, rhs_type, _Op>(AsExpression(lhs), AsExpression(rhs));
+}
+
+/// @brief Evaluates expression into destination, one row at a time
+/// @throw std::invalid_argument if their dimensions differ
+template <typename _Tp, typename _Layout, typename _Expr>
+void Assign(const Vector2DView<_Tp, _Layout>& destination, const _Expr& expression) {
+    const auto dims = destination.dimensions();
+    if (dims.rows != expression.rows() || dims.columns != expression.columns()) {
+        throw std::invalid_argument("");
+    }
+
+    if (dims.columns == 0) {
+        return;
+    }
+
+    for (size_t row = 0; row < dims.rows; ++row) {
+        const auto output = RowOf(destination, row);
+        const auto input  = expression.Row(row);
+
+        for (size_t column = 0; column < dims.columns; ++column) {
+            output[column] = input[column];
+        }
+    }
+}
+
+/// @brief Folds the elements of rows [first_row, end_row) of expression into init with op
+/// Keeps kLanes independent partial results, so the compiler can vectorize the loop even for floating point types,
+/// whose additions it may not reorder; each lane starts from init, so init must leave op's result unchanged, like 0
+/// for a sum or any element for a minimum
+template <typename _Expr, typename _Op>
+auto ReduceRows(const _Expr& expression, typename _Expr::value_type init, _Op op, size_t first_row, size_t end_row) {
+    constexpr size_t kLanes = 8;
+
+    std::array<typename _Expr::value_type, kLanes> lanes;
+    lanes.fill(init);
+
+    const size_t num_columns = expression.columns();
+    for (size_t row = first_row; row < end_row && num_columns != 0; ++row) {
+        const auto input = expression.Row(row);
+
+        size_t column = 0;
+        for (; column + kLanes <= num_columns; column += kLanes) {
+            for (size_t lane = 0; lane < kLanes; ++lane) {
+                lanes[lane] = op(lanes[lane], input[column + lane]);
+            }
+        }
+
+        for (; column < num_columns; ++column) {
+            lanes[0] = op(lanes[0], input[column]);
+        }
+    }
+
+    auto result = lanes[0];
+    for (size_t lane = 1; lane < kLanes; ++lane) {
+        result = op(result, lanes[lane]);
+    }
+
+    return result;
+}
+
+/// @brief Folds every element of expression into init with op
+template <typename _Expr, typename _Op>
+auto Reduce(const _Expr& expression, typename _Expr::value_type init, _Op op) {
+    return ReduceRows(expression, init, op, 0, expression.rows());
+}
+
+/// @throw std::invalid_argument if expression has no elements
+template <typename _Expr, typename _Op>
+auto ReduceNonEmpty(const _Expr& expression, _Op op) {
+    if (expression.rows() == 0 || expression.columns() == 0) {
+        throw std::invalid_argument("");
+    }
+
+    return Reduce(expression, expression.Row(0)[0], op);
+}
+
+struct Minimum {
+    template <typename _Tp>
+    _Tp operator()(_Tp lhs, _Tp rhs) const {
+        return rhs < lhs ? rhs : lhs;
+    }
+};
+
+struct Maximum {
+    template <typename _Tp>
+    _Tp operator()(_Tp lhs, _Tp rhs) const {
+        return lhs < rhs ? rhs : lhs;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Element-wise sum of two operands of the same dimensions, or of an operand and a scalar
+/// @throw std::invalid_argument if both operands are 2D and their dimensions differ
+template <typename _Lhs, typename _Rhs, typename = std::enable_if_t<detail::kIsVector2DBinaryOperands<_Lhs, _Rhs>>>
+auto operator+(const _Lhs& lhs, const _Rhs& rhs) {
+    return detail::MakeBinaryExpression<std::plus<>>(lhs, rhs);
+}
+
+template <typename _Lhs, typename _Rhs, typename = std::enable_if_t<detail::kIsVector2DBinaryOperands<_Lhs, _Rhs>>>
+auto operator-(const _Lhs& lhs, const _Rhs& rhs) {
+    return detail::MakeBinaryExpression<std::minus<>>(lhs, rhs);
+}
+
+template <typename _Lhs, typename _Rhs, typename = std::enable_if_t<detail::kIsVector2DBinaryOperands<_Lhs, _Rhs>>>
+auto operator*(const _Lhs& lhs, const _Rhs& rhs) {
+    return detail::MakeBinaryExpression<std::multiplies<>>(lhs, rhs);
+}
+
+template <typename _Lhs, typename _Rhs, typename = std::enable_if_t<detail::kIsVector2DBinaryOperands<_Lhs, _Rhs>>>
+auto operator/(const _Lhs& lhs, const _Rhs& rhs) {
+    return detail::MakeBinaryExpression<std::divides<>>(lhs, rhs);
+}
+
+template <typename _Operand, typename = std::enable_if_t<detail::kIsVector2DOperand<_Operand>>>
+auto operator-(const _Operand& operand) {
+    using operand_type = std::decay_t<decltype(detail::AsExpression(operand))>;
+
+    return detail::Vector2DUnaryExpression<operand_type, std::negate<>>(detail::AsExpression(operand));
+}
+
+/// @brief Sum of every element, accumulated in the operand's value_type
+template <typename _Operand, typename = std::enable_if_t<detail::kIsVector2DOperand<_Operand>>>
+auto sum(const _Operand& operand) {
+    const auto& expression = detail::AsExpression(operand);
+
+    return detail::Reduce(expression, typename std::decay_t<decltype(expression)>::value_type{}, std::plus<>());
+}
+
+/// @throw std::invalid_argument if operand has no elements
+template <typename _Operand, typename = std::enable_if_t<detail::kIsVector2DOperand<_Operand>>>
+auto min(const _Operand& operand) {
+    return detail::ReduceNonEmpty(detail::AsExpression(operand), detail::Minimum());
+}
+
+/// @throw std::invalid_argument if operand has no elements
+template <typename _Operand, typename = std::enable_if_t<detail::kIsVector2DOperand<_Operand>>>
+auto max(const _Operand& operand) {
+    return detail::ReduceNonEmpty(detail::AsExpression(operand), detail::Maximum());
+}
+
+}  // namespace helpers::containers
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace helpers::containers {
+
+/// @brief Storage layout policies for Vector2D
+/// A layout maps (row, column) to an offset into Vector2D's flat storage. It also describes its tiles: rectangles of
+/// kTileRows x kTileColumns elements that are stored contiguously, and within which each row is contiguous. Vector2D
+/// iterates tile by tile in storage order, so a layout only has to provide these members, and kAlignment: the alignment
+/// of the storage in bytes, or 0 for the alignment of the element type.
+
+/// @brief Each row is stored after the previous one; a tile is a whole row
+struct RowMajorLayout {
+    static constexpr size_t kTileRows    = 1;
+    static constexpr size_t kTileColumns = std::numeric_limits<size_t>::max();
+    static constexpr size_t kAlignment   = 0;
+
+    /// @brief Number of elements to allocate for num_rows x num_columns
+    static constexpr size_t StorageSize(size_t num_rows, size_t num_columns) noexcept {
+        return num_rows * num_columns;
+    }
+
+    static constexpr size_t Offset(size_t row, size_t column, size_t num_columns) noexcept {
+        return (row * num_columns) + column;
+    }
+};
+
+/// @brief Elements are stored in _TileRows x _TileColumns tiles, row-major within a tile and tiles row-major
+/// A column walk or a 2D neighbourhood then stays within a few cache lines instead of touching a new one every row.
+/// Edge tiles are padded to full size, so the storage can be slightly bigger than rows x columns.
+/// @tparam _TileRows rows per tile; a power of two, so locating a tile only takes shifts and masks
+/// @tparam _TileColumns columns per tile; a power of two
+template <size_t _TileRows, size_t _TileColumns>
+struct TiledLayout {
+    static_assert(_TileRows != 0 && (_TileRows & (_TileRows - 1)) == 0, "tile rows must be a power of two");
+    static_assert(_TileColumns != 0 && (_TileColumns & (_TileColumns - 1)) == 0, "tile columns must be a power of two");
+
+    static constexpr size_t kTileRows    = _TileRows;
+    static constexpr size_t kTileColumns = _TileColumns;
+    static constexpr size_t kAlignment   = 0;
+
+    static constexpr size_t StorageSize(size_t num_rows, size_t num_columns) noexcept {
+        return NumTiles(num_rows, _TileRows) * NumTiles(num_columns, _TileColumns) * kTileSize;
+    }
+
+    static constexpr size_t Offset(size_t row, size_t column, size_t num_columns) noexcept {
+        const size_t tile_idx = (row / _TileRows) * NumTiles(num_columns, _TileColumns) + (column / _TileColumns);
+
+        return (tile_idx * kTileSize) + ((row % _TileRows) * _TileColumns) + (column % _TileColumns);
+    }
+
+  private:
+    static constexpr size_t kTileSize = _TileRows * _TileColumns;
+
+    static constexpr size_t NumTiles(size_t num_elements, size_t tile_size) noexcept {
+        return (num_elements + tile_size - 1) / tile_size;
+    }
+};
+
+/// @brief Row-major, with the storage aligned to _Alignment bytes and every row padded to a multiple of _Alignment
+/// bytes, so that every row starts aligned. Vectorized row loops then need neither peel nor remainder code: they can
+/// process whole padded rows with aligned loads. Padding elements are value-initialized like every other element.
+/// @tparam _Tp element type of the Vector2D
+/// @tparam _Alignment alignment in bytes, eg 32 for AVX2 or 64 for a cache line; a multiple of sizeof(_Tp)
+template <typename _Tp, size_t _Alignment = 64>
+struct PaddedRowMajorLayout {
+    static_assert(_Alignment != 0 && (_Alignment & (_Alignment - 1)) == 0, "alignment must be a power of two");
+    static_assert(_Alignment % sizeof(_Tp) == 0, "rows can only be padded to a whole number of elements");
+
+    static constexpr size_t kTileRows    = 1;
+    static constexpr size_t kTileColumns = std::numeric_limits<size_t>::max();
+    static constexpr size_t kAlignment   = _Alignment;
+
+    /// @brief Distance between the first elements of consecutive rows, in elements
+    static constexpr size_t Stride(size_t num_columns) noexcept {
+        return (num_columns + kElementsPerAlignment - 1) / kElementsPerAlignment * kElementsPerAlignment;
+    }
+
+    static constexpr size_t StorageSize(size_t num_rows, size_t num_columns) noexcept {
+        return num_rows * Stride(num_columns);
+    }
+
+    static constexpr size_t Offset(size_t row, size_t column, size_t num_columns) noexcept {
+        return (row * Stride(num_columns)) + column;
+    }
+
+  private:
+    static constexpr size_t kElementsPerAlignment = _Alignment / sizeof(_Tp);
+};
+
+}  // namespace helpers::containers
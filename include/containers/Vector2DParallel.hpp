@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ParallelFor.hpp"
+#include "Vector2D.hpp"
+#include "Vector2DExpression.hpp"
+#include "Vector2DView.hpp"
+
+namespace helpers::containers {
+
+namespace detail {
+
+template <typename _Tp, typename _Layout>
+Vector2DView<_Tp, _Layout> ViewOf(Vector2D<_Tp, _Layout>& vector) noexcept {
+    return vector.view();
+}
+
+template <typename _Tp, typename _Layout>
+Vector2DView<const _Tp, _Layout> ViewOf(const Vector2D<_Tp, _Layout>& vector) noexcept {
+    return vector.view();
+}
+
+template <typename _Tp, typename _Layout>
+Vector2DView<_Tp, _Layout> ViewOf(const Vector2DView<_Tp, _Layout>& view) noexcept {
+    return view;
+}
+
+/// Row blocks of a Vector2D or view start on tile boundaries, so that no two threads write the same tile; they also
+/// match the blocks written by the parallel_first_touch constructor
+template <typename _Tp>
+struct RowGranularity : std::integral_constant<size_t, 1> {};
+
+template <typename _Tp, typename _Layout>
+struct RowGranularity<Vector2D<_Tp, _Layout>> : std::integral_constant<size_t, _Layout::kTileRows> {};
+
+template <typename _Tp, typename _Layout>
+struct RowGranularity<Vector2DView<_Tp, _Layout>> : std::integral_constant<size_t, _Layout::kTileRows> {};
+
+/// Result of one block of parallel_reduce, on its own cache line so that the threads don't write the same one; the
+/// struct also keeps std::vector from packing bools into shared words
+template <typename _Tp>
+struct alignas(64) PartialResult {
+    _Tp value;
+};
+
+/// Element type of a Vector2D, view or expression
+template <typename _Operand>
+using OperandValueType = typename std::decay_t<decltype(AsExpression(std::declval<const _Operand&>()))>::value_type;
+
+}  // namespace detail
+
+/// @brief Calls func(row_idx, row) for every row of a Vector2D or view, splitting the rows into one contiguous block
+/// per thread
+/// row is what vector_or_view.row(row_idx) returns: a StridedSpan for row-major layouts, otherwise a one row view.
+/// func runs concurrently for different rows, so it may only write the row it's given.
+/// @param num_threads 0 for one thread per hardware thread
+/// @throw the first exception thrown by func, once every thread is done
+template <typename _Vector, typename _Func>
+void parallel_for_rows(_Vector&& vector_or_view, _Func func, size_t num_threads = 0) {
+    const auto view = detail::ViewOf(vector_or_view);
+
+    detail::ParallelForBlocks(view.dimensions().rows, detail::RowGranularity<std::decay_t<_Vector>>::value, num_threads,
+                              [&view, &func](size_t, size_t first_row, size_t end_row) {
+                                  for (size_t row = first_row; row < end_row; ++row) {
+                                      func(row, view.row(row));
+                                  }
+                              });
+}
+
+/// @brief Sets every element of output to op applied to the element of input at the same position, splitting the rows
+/// into one contiguous block per thread
+/// @param input Vector2D, view or element-wise expression, eg parallel_transform(a * 2.0f + b, c, [](float x) ...)
+/// @param output Vector2D or view with the dimensions of input
+/// @param num_threads 0 for one thread per hardware thread
+/// @throw std::invalid_argument if the dimensions of input and output differ
+template <typename _Input, typename _Output, typename _Op,
+          typename = std::enable_if_t<detail::kIsVector2DOperand<_Input>>>
+void parallel_transform(const _Input& input, _Output&& output, _Op op, size_t num_threads = 0) {
+    const auto& expression  = detail::AsExpression(input);
+    const auto  destination = detail::ViewOf(output);
+
+    const auto dims = destination.dimensions();
+    if (dims.rows != expression.rows() || dims.columns != expression.columns()) {
+        throw std::invalid_argument("");
+    }
+
+    detail::ParallelForBlocks(dims.rows, detail::RowGranularity<std::decay_t<_Output>>::value, num_threads,
+                              [&](size_t, size_t first_row, size_t end_row) {
+                                  for (size_t row = first_row; row < end_row; ++row) {
+                                      const auto output_row = detail::RowOf(destination, row);
+                                      const auto input_row  = expression.Row(row);
+
+                                      for (size_t column = 0; column < dims.columns; ++column) {
+                                          output_row[column] = op(input_row[column]);
+                                      }
+                                  }
+                              });
+}
+
+/// @brief Folds every element of a Vector2D, view or expression with op, splitting the rows into one contiguous block
+/// per thread
+/// Every thread folds its block starting from identity, and the results of the blocks are then folded in order, so
+/// identity must leave op's result unchanged (0 for a sum, the lowest value for a maximum) and op must be associative
+/// and commutative.
+/// @param num_threads 0 for one thread per hardware thread
+template <typename _Input, typename _Op, typename = std::enable_if_t<detail::kIsVector2DOperand<_Input>>>
+auto parallel_reduce(const _Input& input, detail::OperandValueType<_Input> identity, _Op op, size_t num_threads = 0) {
+    const auto&  expression  = detail::AsExpression(input);
+    const size_t num_rows    = expression.rows();
+    const size_t granularity = detail::RowGranularity<_Input>::value;
+
+    using partial_result_type = detail::PartialResult<decltype(identity)>;
+
+    std::vector<partial_result_type> partial_results(detail::NumParallelBlocks(num_rows, granularity, num_threads),
+                                                     partial_result_type{identity});
+
+    detail::ParallelForBlocks(num_rows, granularity, num_threads,
+                              [&](size_t block_idx, size_t first_row, size_t end_row) {
+                                  partial_results[block_idx].value =
+                                      detail::ReduceRows(expression, identity, op, first_row, end_row);
+                              });
+
+    auto result = identity;
+    for (const auto& partial_result : partial_results) {
+        result = op(result, partial_result.value);
+    }
+
+    return result;
+}
+
+}  // namespace helpers::containers
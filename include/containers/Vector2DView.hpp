@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "StridedSpan.hpp"
+#include "Vector2DLayout.hpp"
+
+namespace helpers::containers {
+
+/// @brief Non-owning view of a rectangular region of a Vector2D, or of any storage laid out by _Layout
+/// Views are cheap to copy and never allocate. They stay valid as long as the storage isn't reallocated, eg by
+/// Vector2D::resize.
+/// @tparam _Tp element type; const _Tp for a read-only view
+/// @tparam _Layout layout of the underlying storage
+template <typename _Tp, typename _Layout = RowMajorLayout>
+class Vector2DView {
+  public:
+    using element_type = _Tp;
+    using value_type   = std::remove_cv_t<_Tp>;
+    using layout_type  = _Layout;
+
+    struct Dimensions {
+        size_t rows;
+        size_t columns;
+    };
+
+    /// true if every row of the storage is contiguous, and consecutive rows are a fixed distance apart; rows and
+    /// columns are then returned as StridedSpans
+    static constexpr bool kStridedRows =
+        _Layout::kTileRows == 1 && _Layout::kTileColumns == std::numeric_limits<size_t>::max();
+
+    /// @brief Visits the elements of the view in row-major order
+    class iterator;
+
+    Vector2DView() noexcept = default;
+
+    /// @param p_data first element of the storage
+    /// @param storage_columns number of columns the storage was laid out for
+    Vector2DView(_Tp* p_data, size_t storage_columns, size_t first_row, size_t first_column, size_t num_rows,
+                 size_t num_columns) noexcept
+        : p_data_(p_data),
+          storage_columns_(storage_columns),
+          first_row_(first_row),
+          first_column_(first_column),
+          num_rows_(num_rows),
+          num_columns_(num_columns) {}
+
+    /// @brief A view of _Tp converts to a view of const _Tp
+    template <typename _Up, typename = std::enable_if_t<std::is_convertible<_Up (*)[], _Tp (*)[]>::value>>
+    Vector2DView(const Vector2DView<_Up, _Layout>& other) noexcept
+        : p_data_(other.p_data_),
+          storage_columns_(other.storage_columns_),
+          first_row_(other.first_row_),
+          first_column_(other.first_column_),
+          num_rows_(other.num_rows_),
+          num_columns_(other.num_columns_) {}
+
+    Dimensions dimensions() const noexcept { return Dimensions{num_rows_, num_columns_}; }
+
+    size_t size() const noexcept { return num_rows_ * num_columns_; }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    /// @throw std::out_of_range if row or column is past the end of the view
+    _Tp& at(size_t row, size_t column) const {
+        if (row >= num_rows_ || column >= num_columns_) {
+            throw std::out_of_range("");
+        }
+
+        return *Address(row, column);
+    }
+
+    _Tp& operator()(size_t row, size_t column) const { return *Address(row, column); }
+
+    /// @return StridedSpan if rows are contiguous (kStridedRows), otherwise a one row view
+    /// @throw std::out_of_range if row_idx is past the end of the view
+    auto row(size_t row_idx) const {
+        CheckRegion(row_idx, 0, 1, num_columns_);
+
+        if constexpr (kStridedRows) {
+            return StridedSpan<_Tp>(Address(row_idx, 0), num_columns_, 1);
+        } else {
+            return subview(row_idx, 0, 1, num_columns_);
+        }
+    }
+
+    /// @return StridedSpan if rows are a fixed distance apart (kStridedRows), otherwise a one column view
+    /// @throw std::out_of_range if column_idx is past the end of the view
+    auto column(size_t column_idx) const {
+        CheckRegion(0, column_idx, num_rows_, 1);
+
+        if constexpr (kStridedRows) {
+            return StridedSpan<_Tp>(Address(0, column_idx), num_rows_, RowStride());
+        } else {
+            return subview(0, column_idx, num_rows_, 1);
+        }
+    }
+
+    /// @brief View of num_rows x num_columns elements, starting at (first_row, first_column) of this view
+    /// @throw std::out_of_range if the region doesn't fit in this view
+    Vector2DView subview(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) const {
+        CheckRegion(first_row, first_column, num_rows, num_columns);
+
+        return Vector2DView(p_data_, storage_columns_, first_row_ + first_row, first_column_ + first_column, num_rows,
+                            num_columns);
+    }
+
+    iterator begin() const { return iterator(*this, num_columns_ == 0 ? num_rows_ : 0); }
+
+    iterator end() const { return iterator(*this, num_rows_); }
+
+  private:
+    template <typename _Up, typename _OtherLayout>
+    friend class Vector2DView;
+
+    _Tp* Address(size_t row, size_t column) const noexcept {
+        return p_data_ + _Layout::Offset(first_row_ + row, first_column_ + column, storage_columns_);
+    }
+
+    size_t RowStride() const noexcept {
+        return _Layout::Offset(1, 0, storage_columns_) - _Layout::Offset(0, 0, storage_columns_);
+    }
+
+    void CheckRegion(size_t first_row, size_t first_column, size_t num_rows, size_t num_columns) const {
+        // written so that nothing can overflow
+        if (first_row > num_rows_ || num_rows > num_rows_ - first_row || first_column > num_columns_ ||
+            num_columns > num_columns_ - first_column) {
+            throw std::out_of_range("");
+        }
+    }
+
+    _Tp* p_data_ = nullptr;
+
+    /// Number of columns of the storage, which the layout needs to locate elements
+    size_t storage_columns_ = 0;
+
+    /// Position of the view in the storage
+    size_t first_row_    = 0;
+    size_t first_column_ = 0;
+
+    size_t num_rows_    = 0;
+    size_t num_columns_ = 0;
+};
+
+template <typename _Tp, typename _Layout>
+class Vector2DView<_Tp, _Layout>::iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::remove_cv_t<_Tp>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = _Tp*;
+    using reference         = _Tp&;
+
+    iterator() noexcept = default;
+
+    iterator(const Vector2DView& view, size_t row) noexcept
+        : view_(view), row_(row), column_(0), p_element_(nullptr) {
+        if (row_ < view_.num_rows_) {
+            p_element_ = view_.Address(row_, 0);
+        }
+    }
+
+    /// @brief postfix increment
+    iterator operator++(int) {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    /// @brief prefix increment
+    iterator& operator++() {
+        ++column_;
+
+        if (column_ == view_.num_columns_) {
+            column_ = 0;
+            ++row_;
+
+            // end() doesn't point anywhere, the row after the view may be past the end of the storage
+            p_element_ = row_ < view_.num_rows_ ? view_.Address(row_, 0) : nullptr;
+        } else if ((view_.first_column_ + column_) % _Layout::kTileColumns == 0) {
+            // crossed into the next tile
+            p_element_ = view_.Address(row_, column_);
+        } else {
+            ++p_element_;
+        }
+
+        return *this;
+    }
+
+    bool operator==(const iterator& rhs) const noexcept {
+        return row_ == rhs.row_ && column_ == rhs.column_ && view_.p_data_ == rhs.view_.p_data_;
+    }
+
+    bool operator!=(const iterator& rhs) const noexcept { return !(*this == rhs); }
+
+    reference operator*() const { return *p_element_; }
+
+    pointer operator->() const { return p_element_; }
+
+    /// @brief Row of the current element, relative to the view
+    size_t row() const noexcept { return row_; }
+
+    /// @brief Column of the current element, relative to the view
+    size_t column() const noexcept { return column_; }
+
+  private:
+    Vector2DView view_;
+
+    size_t row_    = 0;
+    size_t column_ = 0;
+
+    _Tp* p_element_ = nullptr;
+};
+
+}  // namespace helpers::containers
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "containers/AlignedAllocator.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(AlignedAllocatorTest, VectorStorageIsAligned) {
+  for (size_t size = 1; size < 100; size += 7) {
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> values(size);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % 64, 0);
+  }
+}
+
+TEST(AlignedAllocatorTest, Rebind) {
+  // the map rebinds the allocator to its node type
+  std::map<int32_t, int32_t, std::less<int32_t>, AlignedAllocator<std::pair<const int32_t, int32_t>, 128>> map;
+
+  for (int32_t i = 0; i < 10; ++i) {
+    map.emplace(i, i * 2);
+  }
+
+  for (int32_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(map.at(i), i * 2);
+  }
+}
+
+TEST(AlignedAllocatorTest, Equality) {
+  AlignedAllocator<uint32_t, 32> lhs;
+  AlignedAllocator<uint64_t, 32> rhs;
+
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_FALSE(lhs != rhs);
+}
+
+}  // namespace
+}  // namespace helpers::containers
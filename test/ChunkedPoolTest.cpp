@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "containers/ChunkedPool.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(ChunkedPoolTest, EmptyPool) {
+  ChunkedPool<uint64_t, 4> pool;
+
+  EXPECT_TRUE(pool.empty());
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_EQ(pool.capacity(), 0);
+}
+
+TEST(ChunkedPoolTest, GrowsByChunks) {
+  ChunkedPool<uint64_t, 4> pool;
+
+  std::set<uint64_t*> pointers;
+  for (uint64_t i = 0; i < 10; ++i) {
+    auto* p = pool.allocate();
+    *p      = i;
+    pointers.insert(p);
+  }
+
+  EXPECT_EQ(pointers.size(), 10);
+  EXPECT_EQ(pool.size(), 10);
+  EXPECT_EQ(pool.capacity(), 12);
+
+  // objects in earlier chunks weren't moved
+  std::set<uint64_t> values;
+  for (auto* p : pointers) {
+    values.insert(*p);
+  }
+  EXPECT_EQ(values.size(), 10);
+}
+
+TEST(ChunkedPoolTest, RecycleReleasedSlots) {
+  ChunkedPool<uint64_t, 4> pool;
+
+  std::vector<uint64_t*> pointers;
+  for (size_t i = 0; i < 4; ++i) {
+    pointers.push_back(pool.allocate());
+  }
+
+  pool.deallocate(pointers[1]);
+  pool.deallocate(pointers[3]);
+
+  EXPECT_EQ(pool.allocate(), pointers[3]);
+  EXPECT_EQ(pool.allocate(), pointers[1]);
+  EXPECT_EQ(pool.capacity(), 4);
+}
+
+TEST(ChunkedPoolTest, Reserve) {
+  ChunkedPool<std::string, 8> pool;
+
+  pool.reserve(20);
+  EXPECT_EQ(pool.capacity(), 24);
+  EXPECT_TRUE(pool.empty());
+
+  std::vector<std::string*> strings;
+  for (size_t i = 0; i < 24; ++i) {
+    strings.push_back(pool.construct(std::to_string(i)));
+  }
+  EXPECT_EQ(pool.capacity(), 24);
+  EXPECT_EQ(*strings[17], "17");
+
+  for (auto* p_string : strings) {
+    pool.destroy(p_string);
+  }
+  EXPECT_TRUE(pool.empty());
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "containers/ConcurrentFastLinkedList.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(ConcurrentFastLinkedListTest, PushAndPop) {
+  ConcurrentFastLinkedList<std::string, 3> list;
+
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.max_size(), 3);
+
+  EXPECT_TRUE(list.push_front("first"));
+  EXPECT_TRUE(list.emplace_front(5, 'a'));
+  std::string third = "third";
+  EXPECT_TRUE(list.push_front(third));
+  EXPECT_FALSE(list.push_front("fourth"));
+  EXPECT_EQ(list.size(), 3);
+
+  std::string value;
+  ASSERT_TRUE(list.pop_front(value));
+  EXPECT_EQ(value, "third");
+  ASSERT_TRUE(list.pop_front(value));
+  EXPECT_EQ(value, "aaaaa");
+
+  // the released node is reused
+  EXPECT_TRUE(list.push_front("again"));
+  ASSERT_TRUE(list.pop_front(value));
+  EXPECT_EQ(value, "again");
+  ASSERT_TRUE(list.pop_front(value));
+  EXPECT_EQ(value, "first");
+
+  EXPECT_FALSE(list.pop_front(value));
+  EXPECT_EQ(value, "first");
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(ConcurrentFastLinkedListTest, DestroysRemainingElements) {
+  auto p_tracked = std::make_shared<int>(0);
+
+  {
+    ConcurrentFastLinkedList<std::shared_ptr<int>, 4> list;
+    list.push_front(p_tracked);
+    list.push_front(p_tracked);
+    EXPECT_EQ(p_tracked.use_count(), 3);
+  }
+
+  EXPECT_EQ(p_tracked.use_count(), 1);
+}
+
+TEST(ConcurrentFastLinkedListTest, ConcurrentProducersAndConsumers) {
+  constexpr size_t kNumThreads        = 4;
+  constexpr size_t kValuesPerProducer = 20000;
+
+  ConcurrentFastLinkedList<uint64_t, 64> list;
+
+  std::vector<std::atomic<uint32_t>> times_popped(kNumThreads * kValuesPerProducer);
+  std::atomic<size_t>                num_popped{0};
+
+  std::vector<std::thread> threads;
+  for (size_t thread_idx = 0; thread_idx < kNumThreads; ++thread_idx) {
+    threads.emplace_back([&, thread_idx] {
+      for (size_t i = 0; i < kValuesPerProducer; ++i) {
+        while (!list.push_front(thread_idx * kValuesPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    threads.emplace_back([&] {
+      uint64_t value = 0;
+      while (num_popped.load() < kNumThreads * kValuesPerProducer) {
+        if (list.pop_front(value)) {
+          times_popped[value].fetch_add(1);
+          num_popped.fetch_add(1);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& count : times_popped) {
+    EXPECT_EQ(count.load(), 1);
+  }
+
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(ConcurrentFreeListTest, AllocateUntilFull) {
+  ConcurrentFreeList<4> free_list;
+
+  EXPECT_EQ(free_list.capacity(), 4);
+
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(free_list.allocate(), i);
+  }
+
+  EXPECT_EQ(free_list.allocate(), ConcurrentFreeList<4>::npos);
+
+  free_list.deallocate(2);
+  free_list.deallocate(0);
+  EXPECT_EQ(free_list.allocate(), 0);
+  EXPECT_EQ(free_list.allocate(), 2);
+  EXPECT_EQ(free_list.allocate(), ConcurrentFreeList<4>::npos);
+}
+
+TEST(ConcurrentFreeListTest, SlotsAreOwnedByOneThreadAtATime) {
+  constexpr size_t kNumSlots            = 8;
+  constexpr size_t kNumThreads          = 8;
+  constexpr size_t kIterationsPerThread = 20000;
+
+  ConcurrentFreeList<kNumSlots> free_list;
+
+  std::vector<std::atomic<uint32_t>> owners(kNumSlots);
+  std::atomic<bool>                  shared_slot{false};
+
+  std::vector<std::thread> threads;
+  for (size_t thread_idx = 0; thread_idx < kNumThreads; ++thread_idx) {
+    threads.emplace_back([&] {
+      for (size_t i = 0; i < kIterationsPerThread; ++i) {
+        const auto slot_idx = free_list.allocate();
+        if (slot_idx == ConcurrentFreeList<kNumSlots>::npos) {
+          continue;
+        }
+
+        if (owners[slot_idx].fetch_add(1) != 0) {
+          shared_slot = true;
+        }
+
+        owners[slot_idx].fetch_sub(1);
+        free_list.deallocate(slot_idx);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(shared_slot.load());
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "containers/AlignedAllocator.hpp"
+#include "containers/DefaultInitAllocator.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(DefaultInitAllocatorTest, ConstructionWithArgumentsIsForwarded) {
+  std::vector<int32_t, DefaultInitAllocator<std::allocator<int32_t>>> values(10, 5);
+
+  for (const auto value : values) {
+    EXPECT_EQ(value, 5);
+  }
+
+  values.resize(20, 6);
+  EXPECT_EQ(values.back(), 6);
+}
+
+TEST(DefaultInitAllocatorTest, NonTrivialTypesAreStillConstructed) {
+  std::vector<std::string, DefaultInitAllocator<std::allocator<std::string>>> values(4);
+
+  for (const auto& value : values) {
+    EXPECT_TRUE(value.empty());
+  }
+}
+
+TEST(DefaultInitAllocatorTest, AdaptsAlignedAllocator) {
+  std::vector<uint8_t, DefaultInitAllocator<AlignedAllocator<uint8_t, 64>>> values(100);
+
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % 64, 0);
+  EXPECT_EQ(values.size(), 100);
+}
+
+}  // namespace
+}  // namespace helpers::containers
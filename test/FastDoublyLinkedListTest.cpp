@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "containers/FastDoublyLinkedList.hpp"
+
+namespace helpers::containers {
+namespace {
+
+template <typename _List>
+std::vector<typename _List::value_type> ToVector(const _List& list) {
+  return std::vector<typename _List::value_type>(list.begin(), list.end());
+}
+
+TEST(FastDoublyLinkedListTest, EmptyList) {
+  FastDoublyLinkedList<uint32_t, 10> list;
+
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0);
+  EXPECT_EQ(list.max_size(), 10);
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_THROW(list.front(), std::out_of_range);
+  EXPECT_THROW(list.back(), std::out_of_range);
+
+  const FastDoublyLinkedList<uint32_t, 10>::Handle null_handle;
+  EXPECT_FALSE(null_handle);
+  EXPECT_FALSE(list.contains(null_handle));
+  EXPECT_FALSE(list.erase(null_handle));
+  EXPECT_THROW(list.at(null_handle), std::out_of_range);
+}
+
+TEST(FastDoublyLinkedListTest, EndHandle) {
+  FastDoublyLinkedList<uint32_t, 10> list;
+
+  const auto end_handle = list.end().handle();
+  EXPECT_EQ(end_handle.generation, 0);
+  EXPECT_FALSE(list.contains(end_handle));
+
+  list.push_back(1);
+  list.erase(list.begin().handle());
+  EXPECT_EQ(list.end().handle(), end_handle);
+}
+
+TEST(FastDoublyLinkedListTest, PushFrontAndBack) {
+  FastDoublyLinkedList<std::string, 4> list;
+
+  const auto b = list.push_back("b");
+  const auto a = list.push_front("a");
+  const auto c = list.emplace_back(1, 'c');
+  const auto d = list.push_back("d");
+
+  EXPECT_TRUE(list.full());
+  EXPECT_FALSE(list.push_back("e"));
+  EXPECT_FALSE(list.push_front("e"));
+
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"a", "b", "c", "d"}));
+  EXPECT_EQ(list.front(), "a");
+  EXPECT_EQ(list.back(), "d");
+  EXPECT_EQ(list.at(a), "a");
+  EXPECT_EQ(list.at(b), "b");
+  EXPECT_EQ(list.at(c), "c");
+  EXPECT_EQ(list.at(d), "d");
+
+  EXPECT_EQ(*std::prev(list.end()), "d");
+  EXPECT_EQ(std::next(list.begin()).handle(), b);
+}
+
+TEST(FastDoublyLinkedListTest, EraseByHandle) {
+  FastDoublyLinkedList<uint32_t, 8> list;
+
+  std::vector<FastDoublyLinkedList<uint32_t, 8>::Handle> handles;
+  for (uint32_t i = 0; i < 8; ++i) {
+    handles.push_back(list.push_back(i));
+  }
+
+  EXPECT_TRUE(list.erase(handles[3]));
+  EXPECT_TRUE(list.erase(handles[0]));
+  EXPECT_TRUE(list.erase(handles[7]));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{1, 2, 4, 5, 6}));
+
+  // erasing twice is detected
+  EXPECT_FALSE(list.erase(handles[3]));
+  EXPECT_FALSE(list.contains(handles[3]));
+  EXPECT_EQ(list.size(), 5);
+
+  // the node is reused, but the old handle still refers to the erased element
+  const auto reused = list.push_front(100);
+  EXPECT_EQ(reused.node_idx, handles[7].node_idx);
+  EXPECT_NE(reused, handles[7]);
+  EXPECT_FALSE(list.contains(handles[7]));
+  EXPECT_THROW(list.at(handles[7]), std::out_of_range);
+  EXPECT_EQ(list.at(reused), 100);
+
+  list.pop_front();
+  list.pop_back();
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{1, 2, 4, 5}));
+  EXPECT_FALSE(list.contains(reused));
+  EXPECT_FALSE(list.contains(handles[6]));
+}
+
+TEST(FastDoublyLinkedListTest, MoveToFrontAndBack) {
+  FastDoublyLinkedList<uint32_t, 5> list;
+
+  std::vector<FastDoublyLinkedList<uint32_t, 5>::Handle> handles;
+  for (uint32_t i = 0; i < 5; ++i) {
+    handles.push_back(list.push_back(i));
+  }
+
+  EXPECT_TRUE(list.move_to_front(handles[3]));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{3, 0, 1, 2, 4}));
+
+  EXPECT_TRUE(list.move_to_back(handles[0]));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{3, 1, 2, 4, 0}));
+
+  EXPECT_TRUE(list.move_to_front(handles[3]));
+  EXPECT_TRUE(list.move_to_back(handles[0]));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{3, 1, 2, 4, 0}));
+
+  // handles survive moves
+  EXPECT_EQ(list.at(handles[3]), 3);
+  list.erase(handles[2]);
+  EXPECT_FALSE(list.move_to_front(handles[2]));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{3, 1, 4, 0}));
+
+  std::vector<uint32_t> reversed;
+  for (auto iter = list.end(); iter != list.begin();) {
+    reversed.push_back(*--iter);
+  }
+  EXPECT_EQ(reversed, (std::vector<uint32_t>{0, 4, 1, 3}));
+}
+
+TEST(FastDoublyLinkedListTest, ClearInvalidatesHandles) {
+  FastDoublyLinkedList<std::string, 4> list;
+
+  const auto first = list.push_back("first");
+  list.push_back("second");
+  list.clear();
+
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(list.contains(first));
+
+  // the same node is handed out again after clear(), with a new generation
+  const auto again = list.push_back("again");
+  EXPECT_EQ(again.node_idx, first.node_idx);
+  EXPECT_FALSE(list.contains(first));
+  EXPECT_EQ(list.at(again), "again");
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"again"}));
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -1,10 +1,44 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "containers/FastLinkedList.hpp"
 
 namespace helpers::containers {
 namespace {
 
+template <typename _List>
+std::vector<typename _List::value_type> ToVector(const _List& list) {
+  return std::vector<typename _List::value_type>(list.begin(), list.end());
+}
+
+/// Not default constructible; counts live instances so tests can check that every element is destroyed
+class Tracked {
+ public:
+  explicit Tracked(int value) : value_(value) { ++num_alive; }
+  Tracked(const Tracked& other) : value_(other.value_) { ++num_alive; }
+  Tracked(Tracked&& other) noexcept : value_(other.value_) { ++num_alive; }
+  Tracked& operator=(const Tracked&) = default;
+  Tracked& operator=(Tracked&&) = default;
+  ~Tracked() { --num_alive; }
+
+  bool operator==(const Tracked& other) const { return value_ == other.value_; }
+
+  int value() const { return value_; }
+
+  inline static int num_alive = 0;
+
+ private:
+  int value_;
+};
+
 TEST(FastLinkedListTest, EmptyList) {
   FastLinkedList<uint32_t, 10> list;
 
@@ -82,5 +116,307 @@ TEST(FastLinkedList, PopFront) {
   EXPECT_EQ(list.front(), 3);
 }
 
+TEST(FastLinkedList, ReuseNodesAfterPopAndRemove) {
+  FastLinkedList<uint32_t, 4> list;
+
+  // cycle through many more values than there are nodes, so released nodes must be recycled
+  for (uint32_t i = 0; i < 100; ++i) {
+    list.push_front(i);
+    list.push_front(i + 1);
+    list.push_front(i + 2);
+    list.remove(i + 1);
+    list.pop_front();
+
+    ASSERT_EQ(list.size(), 1);
+    ASSERT_EQ(list.front(), i);
+    list.pop_front();
+    ASSERT_TRUE(list.empty());
+  }
+
+  for (uint32_t i = 0; i < 4; ++i) {
+    list.push_front(i);
+  }
+  EXPECT_TRUE(list.full());
+  EXPECT_EQ(list.front(), 3);
+}
+
+TEST(FastLinkedList, RepeatedClear) {
+  FastLinkedList<std::string, 8> list;
+
+  for (size_t round = 0; round < 10; ++round) {
+    for (size_t i = 0; i < 8; ++i) {
+      list.push_front(std::to_string(round * 8 + i));
+    }
+    ASSERT_TRUE(list.full());
+
+    // pushing into a full list is a no-op
+    list.push_front("overflow");
+    ASSERT_EQ(list.front(), std::to_string(round * 8 + 7));
+
+    list.pop_front();
+    list.push_front("last");
+    ASSERT_EQ(list.front(), "last");
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+  }
+}
+
+TEST(FastLinkedList, NonDefaultConstructibleType) {
+  {
+    FastLinkedList<Tracked, 8> list;
+    EXPECT_EQ(Tracked::num_alive, 0);
+
+    list.emplace_front(1);
+    list.push_front(Tracked(2));
+    list.emplace_front(3);
+    EXPECT_EQ(Tracked::num_alive, 3);
+    EXPECT_EQ(list.front().value(), 3);
+
+    list.pop_front();
+    EXPECT_EQ(Tracked::num_alive, 2);
+
+    list.remove(Tracked(1));
+    EXPECT_EQ(Tracked::num_alive, 1);
+    ASSERT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front().value(), 2);
+
+    list.emplace_front(4);
+    list.emplace_front(5);
+    list.clear();
+    EXPECT_EQ(Tracked::num_alive, 0);
+
+    list.emplace_front(6);
+    list.emplace_front(7);
+  }
+
+  // the destructor destroys the remaining elements
+  EXPECT_EQ(Tracked::num_alive, 0);
+}
+
+TEST(FastLinkedList, RemoveValueStoredInList) {
+  FastLinkedList<std::string, 8> list;
+
+  list.push_front("a");
+  list.push_front("b");
+  list.push_front("a");
+  list.push_front("c");
+  list.push_front("a");
+
+  // the argument refers to the first element, which must stay alive until the whole list has been searched
+  list.remove(list.front());
+
+  ASSERT_EQ(list.size(), 2);
+  EXPECT_EQ(list.front(), "c");
+  list.pop_front();
+  EXPECT_EQ(list.front(), "b");
+}
+
+TEST(FastLinkedList, CopyAndMove) {
+  {
+    FastLinkedList<Tracked, 8> list;
+    for (int i = 0; i < 5; ++i) {
+      list.emplace_front(i);
+    }
+    list.remove(Tracked(2));
+
+    FastLinkedList<Tracked, 8> copy(list);
+    EXPECT_EQ(Tracked::num_alive, 8);
+    ASSERT_EQ(copy.size(), 4);
+
+    FastLinkedList<Tracked, 8> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(Tracked::num_alive, 8);
+
+    for (int expected : {4, 3, 1, 0}) {
+      ASSERT_EQ(copy.front().value(), expected);
+      ASSERT_EQ(moved.front().value(), expected);
+      copy.pop_front();
+      moved.pop_front();
+    }
+
+    copy.emplace_front(10);
+    moved = copy;
+    EXPECT_EQ(moved.front().value(), 10);
+    EXPECT_EQ(Tracked::num_alive, 2);
+
+    list = std::move(moved);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(list.front().value(), 10);
+  }
+
+  EXPECT_EQ(Tracked::num_alive, 0);
+}
+
+TEST(FastLinkedList, CompactIndexType) {
+  static_assert(std::is_same<FastLinkedList<uint16_t, 200>::index_type, uint8_t>::value);
+  static_assert(std::is_same<FastLinkedList<uint16_t, 255>::index_type, uint8_t>::value);
+  static_assert(std::is_same<FastLinkedList<uint16_t, 256>::index_type, uint16_t>::value);
+  static_assert(std::is_same<FastLinkedList<uint16_t, 65536>::index_type, uint32_t>::value);
+
+  // both capacities give node arrays that are a multiple of 8 bytes, so the difference is exactly 16 nodes
+
+  // 2 bytes of payload plus a 1 byte link, padded to the payload's alignment
+  EXPECT_EQ(sizeof(FastLinkedList<uint16_t, 216>) - sizeof(FastLinkedList<uint16_t, 200>), 16 * 4);
+
+  // values and links in separate arrays need no padding
+  EXPECT_EQ(sizeof(FastLinkedList<uint16_t, 216, true>) - sizeof(FastLinkedList<uint16_t, 200, true>), 16 * 3);
+}
+
+TEST(FastLinkedList, StructOfArrays) {
+  FastLinkedList<std::string, 255, true> list;
+
+  for (size_t i = 0; i < 255; ++i) {
+    list.push_front(std::to_string(i));
+  }
+  EXPECT_TRUE(list.full());
+
+  list.remove("100");
+  list.pop_front();
+  list.push_front("new");
+  list.push_front("newer");
+  EXPECT_TRUE(list.full());
+
+  FastLinkedList<std::string, 255, true> copy(list);
+  for (size_t i = 0; i < 255; ++i) {
+    ASSERT_EQ(list.front(), copy.front());
+    list.pop_front();
+    copy.pop_front();
+  }
+  EXPECT_TRUE(list.empty());
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(FastLinkedList, Iterate) {
+  FastLinkedList<uint32_t, 10> list;
+  EXPECT_EQ(list.begin(), list.end());
+
+  for (uint32_t i = 0; i < 5; ++i) {
+    list.push_front(i);
+  }
+
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{4, 3, 2, 1, 0}));
+  EXPECT_EQ(std::distance(list.begin(), list.end()), 5);
+  EXPECT_EQ(std::next(list.before_begin()), list.begin());
+
+  for (auto& value : list) {
+    value *= 10;
+  }
+
+  const auto& const_list = list;
+  const auto  iter       = std::find(const_list.begin(), const_list.end(), 20U);
+  ASSERT_NE(iter, list.cend());
+  EXPECT_EQ(*std::next(iter), 10U);
+}
+
+TEST(FastLinkedList, InsertAndEraseAfter) {
+  FastLinkedList<std::string, 5> list;
+
+  auto iter = list.insert_after(list.before_begin(), "a");
+  iter      = list.insert_after(iter, "c");
+  list.emplace_after(list.begin(), 1, 'b');
+  list.emplace_after(iter, "d");
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+  // iterators refer to nodes, so they survive other insertions and erasures
+  list.erase_after(list.begin());
+  EXPECT_EQ(*iter, "c");
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"a", "c", "d"}));
+
+  EXPECT_EQ(*list.erase_after(list.before_begin()), "c");
+  EXPECT_EQ(list.erase_after(iter), list.end());
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"c"}));
+
+  for (size_t i = 0; i < 4; ++i) {
+    list.insert_after(list.before_begin(), std::to_string(i));
+  }
+  EXPECT_TRUE(list.full());
+  EXPECT_EQ(list.insert_after(list.begin(), "full"), list.end());
+  EXPECT_EQ(list.size(), 5);
+
+  EXPECT_EQ(list.erase_after(list.begin(), iter), iter);
+  EXPECT_EQ(ToVector(list), (std::vector<std::string>{"3", "c"}));
+}
+
+TEST(FastLinkedList, RemoveIf) {
+  FastLinkedList<uint32_t, 16, true> list;
+
+  for (uint32_t i = 0; i < 16; ++i) {
+    list.push_front(i);
+  }
+
+  list.remove_if([](uint32_t value) { return value % 3 != 0; });
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{15, 12, 9, 6, 3, 0}));
+
+  list.remove_if([](uint32_t) { return true; });
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(FastLinkedList, SpliceBetweenLists) {
+  FastLinkedList<Tracked, 6> list;
+  FastLinkedList<Tracked, 6> other;
+
+  list.emplace_front(2);
+  list.emplace_front(1);
+  for (int i = 13; i >= 10; --i) {
+    other.emplace_front(i);
+  }
+
+  // move the element after 10 (11) to the front
+  list.splice_after(list.before_begin(), other, other.begin());
+  ASSERT_EQ(list.size(), 3);
+  EXPECT_EQ(list.front().value(), 11);
+  EXPECT_EQ(other.size(), 3);
+
+  // move (10, end) to the back
+  list.splice_after(std::next(list.begin(), 2), other, other.begin(), other.end());
+  EXPECT_EQ(list.size(), 5);
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(other.front().value(), 10);
+
+  std::vector<int> values;
+  for (const auto& element : list) {
+    values.push_back(element.value());
+  }
+  EXPECT_EQ(values, (std::vector<int>{11, 1, 2, 12, 13}));
+
+  other.emplace_front(9);
+  EXPECT_THROW(list.splice_after(list.before_begin(), other), std::length_error);
+  EXPECT_EQ(list.size(), 5);
+  EXPECT_EQ(other.size(), 2);
+
+  other.pop_front();
+  list.splice_after(list.before_begin(), other);
+  EXPECT_TRUE(list.full());
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(list.front().value(), 10);
+
+  list.clear();
+  EXPECT_EQ(Tracked::num_alive, 0);
+}
+
+TEST(FastLinkedList, SpliceWithinList) {
+  FastLinkedList<uint32_t, 8> list;
+
+  for (uint32_t i = 0; i < 6; ++i) {
+    list.push_front(i);
+  }
+
+  // move (5, 2) = {4, 3} after 1
+  const auto first = list.begin();
+  const auto last  = std::next(first, 3);
+  list.splice_after(std::next(first, 4), list, first, last);
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{5, 2, 1, 4, 3, 0}));
+
+  // move the last element to the front
+  list.splice_after(list.before_begin(), list, std::next(list.begin(), 4));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{0, 5, 2, 1, 4, 3}));
+
+  // splicing a range right after itself is a no-op
+  list.splice_after(list.begin(), list, list.begin(), std::next(list.begin(), 3));
+  EXPECT_EQ(ToVector(list), (std::vector<uint32_t>{0, 5, 2, 1, 4, 3}));
+  EXPECT_EQ(list.size(), 6);
+}
+
 }  // namespace
 }  // namespace helpers::containers
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "containers/FixedLruCache.hpp"
+
+namespace helpers::containers {
+namespace {
+
+/// Sends every key to the same bucket, so that every entry is in one probe run
+struct CollidingHash {
+  size_t operator()(uint32_t) const noexcept { return 0; }
+};
+
+TEST(FixedLruCacheTest, EmptyCache) {
+  FixedLruCache<uint32_t, std::string, 4> cache;
+
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.capacity(), 4);
+  EXPECT_EQ(cache.get(1), nullptr);
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_FALSE(cache.erase(1));
+}
+
+TEST(FixedLruCacheTest, PutAndGet) {
+  FixedLruCache<std::string, uint32_t, 4> cache;
+
+  cache.put("one", 1);
+  cache.put("two", 2);
+  EXPECT_EQ(cache.size(), 2);
+
+  ASSERT_NE(cache.get("one"), nullptr);
+  EXPECT_EQ(*cache.get("one"), 1);
+  EXPECT_EQ(*cache.peek("two"), 2);
+  EXPECT_EQ(cache.get("three"), nullptr);
+
+  // put replaces the value of an existing key
+  EXPECT_EQ(cache.put("one", 10), 10);
+  EXPECT_EQ(*cache.get("one"), 10);
+  EXPECT_EQ(cache.size(), 2);
+
+  *cache.get("two") = 20;
+  EXPECT_EQ(*cache.peek("two"), 20);
+}
+
+TEST(FixedLruCacheTest, EvictsLeastRecentlyUsed) {
+  std::vector<std::pair<uint32_t, std::string>> evicted;
+
+  auto on_evict = [&evicted](const uint32_t& key, std::string& value) { evicted.emplace_back(key, std::move(value)); };
+  FixedLruCache<uint32_t, std::string, 3, std::hash<uint32_t>, decltype(on_evict)> cache(on_evict);
+
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.put(3, "c");
+
+  // 1 becomes the most recently used, so 2 is evicted next
+  cache.get(1);
+  cache.put(4, "d");
+  ASSERT_EQ(evicted.size(), 1);
+  EXPECT_EQ(evicted.back(), (std::pair<uint32_t, std::string>{2, "b"}));
+  EXPECT_FALSE(cache.contains(2));
+
+  // peek doesn't change recency, put does
+  cache.peek(3);
+  cache.put(1, "aa");
+  cache.put(5, "e");
+  ASSERT_EQ(evicted.size(), 2);
+  EXPECT_EQ(evicted.back(), (std::pair<uint32_t, std::string>{3, "c"}));
+
+  // erase and clear don't invoke the callback
+  cache.erase(4);
+  cache.clear();
+  EXPECT_EQ(evicted.size(), 2);
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.get(1), nullptr);
+}
+
+TEST(FixedLruCacheTest, EraseWithinProbeRun) {
+  FixedLruCache<uint32_t, uint32_t, 8, CollidingHash> cache;
+
+  for (uint32_t i = 0; i < 8; ++i) {
+    cache.put(i, i * 10);
+  }
+
+  // erasing from the middle of the probe run must keep the entries after it reachable
+  EXPECT_TRUE(cache.erase(3));
+  EXPECT_TRUE(cache.erase(0));
+  for (uint32_t i = 0; i < 8; ++i) {
+    if (i == 0 || i == 3) {
+      EXPECT_FALSE(cache.contains(i));
+    } else {
+      ASSERT_NE(cache.peek(i), nullptr);
+      EXPECT_EQ(*cache.peek(i), i * 10);
+    }
+  }
+}
+
+TEST(FixedLruCacheTest, MoveOnlyValues) {
+  FixedLruCache<uint32_t, std::unique_ptr<uint32_t>, 2> cache;
+
+  cache.put(1, std::make_unique<uint32_t>(1));
+  cache.put(2, std::make_unique<uint32_t>(2));
+  cache.put(3, std::make_unique<uint32_t>(3));
+
+  EXPECT_EQ(cache.get(1), nullptr);
+  EXPECT_EQ(**cache.get(3), 3);
+}
+
+TEST(FixedLruCacheTest, MatchesReferenceModel) {
+  constexpr size_t kCapacity = 64;
+
+  FixedLruCache<uint32_t, uint32_t, kCapacity> cache;
+
+  // reference model: key -> (value, time of last use)
+  std::unordered_map<uint32_t, std::pair<uint32_t, uint64_t>> model;
+
+  std::mt19937                            gen(7);
+  std::uniform_int_distribution<uint32_t> key_dist(0, 4 * kCapacity);
+  std::uniform_int_distribution<uint32_t> op_dist(0, 9);
+
+  for (uint64_t time = 0; time < 100000; ++time) {
+    const auto key = key_dist(gen);
+    const auto op  = op_dist(gen);
+
+    if (op < 5) {
+      auto* p_value = cache.get(key);
+      auto  found   = model.find(key);
+
+      ASSERT_EQ(p_value != nullptr, found != model.end());
+      if (p_value != nullptr) {
+        ASSERT_EQ(*p_value, found->second.first);
+        found->second.second = time;
+      }
+    } else if (op < 9) {
+      if (model.count(key) == 0 && model.size() == kCapacity) {
+        auto lru = model.begin();
+        for (auto iter = model.begin(); iter != model.end(); ++iter) {
+          if (iter->second.second < lru->second.second) {
+            lru = iter;
+          }
+        }
+        model.erase(lru);
+      }
+
+      cache.put(key, static_cast<uint32_t>(time));
+      model[key] = {static_cast<uint32_t>(time), time};
+    } else {
+      ASSERT_EQ(cache.erase(key), model.erase(key) != 0);
+    }
+
+    ASSERT_EQ(cache.size(), model.size());
+  }
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include "containers/FixedPool.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(FixedPoolTest, EmptyPool) {
+  FixedPool<uint64_t, 8> pool;
+
+  EXPECT_TRUE(pool.empty());
+  EXPECT_FALSE(pool.full());
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_EQ(pool.capacity(), 8);
+}
+
+TEST(FixedPoolTest, AllocateUntilFull) {
+  FixedPool<uint64_t, 8> pool;
+
+  std::set<uint64_t*> pointers;
+  for (size_t i = 0; i < 8; ++i) {
+    auto* p = pool.allocate();
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(pool.owns(p));
+    *p = i;
+    pointers.insert(p);
+  }
+
+  EXPECT_EQ(pointers.size(), 8);
+  EXPECT_TRUE(pool.full());
+  EXPECT_EQ(pool.allocate(), nullptr);
+
+  uint64_t not_in_pool = 0;
+  EXPECT_FALSE(pool.owns(&not_in_pool));
+}
+
+TEST(FixedPoolTest, RecycleReleasedSlots) {
+  FixedPool<uint64_t, 4> pool;
+
+  auto* p_first  = pool.allocate();
+  auto* p_second = pool.allocate();
+  pool.allocate();
+  pool.allocate();
+
+  pool.deallocate(p_second);
+  pool.deallocate(p_first);
+  EXPECT_EQ(pool.size(), 2);
+
+  // released slots are handed out again, most recently released first
+  EXPECT_EQ(pool.allocate(), p_first);
+  EXPECT_EQ(pool.allocate(), p_second);
+  EXPECT_EQ(pool.allocate(), nullptr);
+}
+
+TEST(FixedPoolTest, ConstructAndDestroy) {
+  FixedPool<std::string, 2> pool;
+
+  auto* p_first  = pool.construct(5, 'a');
+  auto* p_second = pool.construct("second");
+  EXPECT_EQ(*p_first, "aaaaa");
+  EXPECT_EQ(*p_second, "second");
+  EXPECT_EQ(pool.construct("third"), nullptr);
+
+  pool.destroy(p_first);
+  pool.destroy(p_second);
+  EXPECT_TRUE(pool.empty());
+}
+
+TEST(FixedPoolTest, OverAlignedType) {
+  struct alignas(64) CacheLine {
+    uint8_t bytes[64];
+  };
+
+  FixedPool<CacheLine, 4> pool;
+
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pool.allocate()) % 64, 0);
+  }
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "containers/FixedVector2D.hpp"
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DExpression.hpp"
+
+namespace helpers::containers {
+namespace {
+
+/// @brief Trace of a matrix, computed at compile time in the static_asserts below
+template <typename _Vector>
+constexpr auto Trace(const _Vector& matrix) {
+    typename _Vector::value_type trace{};
+    for (size_t i = 0; i < _Vector::capacity().rows; ++i) {
+        trace += matrix(i, i);
+    }
+    return trace;
+}
+
+constexpr FixedVector2D<int32_t, 3, 3> kMatrix{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+static_assert(kMatrix(1, 2) == 6);
+static_assert(kMatrix.at(2, 0) == 7);
+static_assert(Trace(kMatrix) == 15);
+static_assert(FixedVector2D<int32_t, 4, 4>(2)(3, 3) == 2);
+static_assert(FixedVector2D<int32_t, 2, 5>::capacity().columns == 5);
+
+// nothing but the elements
+static_assert(sizeof(FixedVector2D<float, 4, 4>) == 16 * sizeof(float));
+static_assert(std::is_trivially_copyable<FixedVector2D<float, 4, 4>>::value);
+
+TEST(FixedVector2DTest, ElementsAreValueInitialized) {
+    FixedVector2D<uint32_t, 3, 5> vector;
+
+    size_t num_elements = 0;
+    for (const auto element : vector) {
+        EXPECT_EQ(element, 0);
+        ++num_elements;
+    }
+    EXPECT_EQ(num_elements, 15);
+}
+
+TEST(FixedVector2DTest, RowByRowInitialization) {
+    const FixedVector2D<int32_t, 2, 3> vector{{1, 2}, {3, 4, 5}};
+
+    EXPECT_EQ(vector(0, 0), 1);
+    EXPECT_EQ(vector(0, 1), 2);
+    EXPECT_EQ(vector(0, 2), 0);
+    EXPECT_EQ(vector(1, 2), 5);
+
+    using Vector = FixedVector2D<int32_t, 2, 3>;
+    EXPECT_THROW(Vector({{1}, {2}, {3}}), std::invalid_argument);
+    EXPECT_THROW(Vector({{1, 2, 3, 4}}), std::invalid_argument);
+}
+
+TEST(FixedVector2DTest, OutOfRange) {
+    FixedVector2D<int32_t, 2, 3> vector;
+
+    EXPECT_THROW(vector.at(2, 0), std::out_of_range);
+    EXPECT_THROW(vector.at(0, 3), std::out_of_range);
+    EXPECT_THROW(vector.row(2), std::out_of_range);
+}
+
+TEST(FixedVector2DTest, RowsAndColumns) {
+    FixedVector2D<int32_t, 3, 3> vector = kMatrix;
+
+    EXPECT_EQ(vector.stride(), 3);
+    EXPECT_EQ(vector.row(1)[2], 6);
+    EXPECT_EQ(vector.column(1)[2], 8);
+
+    for (auto& element : vector.subview(1, 1, 2, 2)) {
+        element = 0;
+    }
+    EXPECT_EQ(Trace(vector), 1);
+}
+
+TEST(FixedVector2DTest, Expressions) {
+    const FixedVector2D<double, 2, 2> a{{1.0, 2.0}, {3.0, 4.0}};
+    const Vector2D<double>            b(2, 2, 0.5);
+
+    FixedVector2D<double, 2, 2> result = a * 2.0 + b;
+    EXPECT_DOUBLE_EQ(result(1, 1), 8.5);
+
+    result -= a;
+    EXPECT_DOUBLE_EQ(result(1, 1), 4.5);
+    EXPECT_DOUBLE_EQ(sum(result), 1.5 + 2.5 + 3.5 + 4.5);
+    EXPECT_DOUBLE_EQ(max(a), 4.0);
+
+    // a Vector2D can be built from a fixed one and the other way around
+    const Vector2D<double> copy = a + 0.0;
+    EXPECT_DOUBLE_EQ(copy(1, 0), 3.0);
+
+    const Vector2D<double> wrong_size(3, 2);
+    EXPECT_THROW(result = wrong_size + 0.0, std::invalid_argument);
+}
+
+TEST(FixedVector2DTest, TiledLayout) {
+    FixedVector2D<uint32_t, 6, 6, TiledLayout<4, 4>> vector;
+
+    size_t num_visited = 0;
+    vector.for_each_by_tile([&](size_t row, size_t column, uint32_t& element) {
+        element = row * 6 + column;
+        ++num_visited;
+    });
+    EXPECT_EQ(num_visited, 36);
+
+    uint32_t i = 0;
+    for (const auto element : vector) {
+        EXPECT_EQ(element, i++);
+    }
+}
+
+TEST(FixedVector2DTest, PaddedLayout) {
+    FixedVector2D<float, 3, 5, PaddedRowMajorLayout<float, 32>> vector(1.0f);
+
+    EXPECT_EQ(vector.stride(), 8);
+    for (size_t row = 0; row < 3; ++row) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&vector(row, 0)) % 32, 0);
+    }
+    EXPECT_EQ(sum(vector), 15.0f);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include "containers/ImmutableIntegerMap.hpp"
+#include "containers/PoolAllocator.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(ImmutableIntegerMapTest, SequentialKeys) {
+  std::map<uint64_t, uint32_t> input_map;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    input_map.emplace(1'000'000'000'000 + i, static_cast<uint32_t>(i));
+  }
+
+  ImmutableIntegerMap<uint64_t, uint32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.count(k), 1);
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.count(0), 0);
+  EXPECT_EQ(immutable_map.count(1'000'000'000'000 - 1), 0);
+  EXPECT_EQ(immutable_map.count(1'000'000'000'000 + 1000), 0);
+  EXPECT_THROW(immutable_map.at(5), std::out_of_range);
+
+  auto input_map_iter = input_map.begin();
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, input_map_iter->first);
+    EXPECT_EQ(v, input_map_iter->second);
+    ++input_map_iter;
+  }
+  EXPECT_TRUE(input_map_iter == input_map.end());
+}
+
+TEST(ImmutableIntegerMapTest, SparseSignedKeys) {
+  std::map<int32_t, int32_t> input_map = {{std::numeric_limits<int32_t>::min(), 1},
+                                          {-1000, 2},
+                                          {-1, 3},
+                                          {0, 4},
+                                          {7, 5},
+                                          {99, 6},
+                                          {std::numeric_limits<int32_t>::max(), 7}};
+
+  ImmutableIntegerMap<int32_t, int32_t, 4> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.count(-999), 0);
+  EXPECT_EQ(immutable_map.count(1), 0);
+  EXPECT_EQ(immutable_map.count(100), 0);
+
+  auto input_map_iter = input_map.begin();
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, input_map_iter->first);
+    EXPECT_EQ(v, input_map_iter->second);
+    ++input_map_iter;
+  }
+}
+
+TEST(ImmutableIntegerMapTest, FullWidthDeltas) {
+  const std::unordered_map<uint64_t, int32_t> input_map = {
+      {0, 1}, {1, 2}, {std::numeric_limits<uint64_t>::max() - 1, 3}, {std::numeric_limits<uint64_t>::max(), 4}};
+
+  ImmutableIntegerMap<uint64_t, int32_t, 3> immutable_map(input_map);
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.count(2), 0);
+  EXPECT_EQ(immutable_map.count(std::numeric_limits<uint64_t>::max() - 2), 0);
+}
+
+TEST(ImmutableIntegerMapTest, GreaterThanCompareStdMap) {
+  const std::map<uint16_t, int32_t, std::greater<uint16_t>> input_map = {{1, 2}, {3, 7}, {19, 5}, {2, 12}, {7, 99}};
+
+  ImmutableIntegerMap<uint16_t, int32_t, 2> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  auto input_map_iter = input_map.rbegin();
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, input_map_iter->first);
+    EXPECT_EQ(v, input_map_iter->second);
+    ++input_map_iter;
+  }
+}
+
+TEST(ImmutableIntegerMapTest, EmptyStdMap) {
+  const std::map<uint64_t, uint32_t> input_map;
+
+  ImmutableIntegerMap<uint64_t, uint32_t> immutable_map(input_map);
+
+  EXPECT_TRUE(immutable_map.empty());
+  EXPECT_EQ(immutable_map.count(0), 0);
+  EXPECT_THROW(immutable_map.at(0), std::out_of_range);
+}
+
+TEST(ImmutableIntegerMapTest, BoolValues) {
+  std::map<int32_t, bool> input_map;
+  for (int32_t i = -50; i < 50; ++i) {
+    input_map.emplace(i * 3, i % 3 == 0);
+  }
+
+  ImmutableIntegerMap<int32_t, bool> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  // every value is returned by reference, so each bool needs its own address
+  const bool& first = immutable_map.at(-144);
+  EXPECT_TRUE(first);
+  EXPECT_FALSE(immutable_map[-147]);
+  EXPECT_NE(&immutable_map.at(-141), &first);
+
+  auto input_map_iter = input_map.begin();
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, input_map_iter->first);
+    EXPECT_EQ(v, input_map_iter->second);
+    ++input_map_iter;
+  }
+}
+
+TEST(ImmutableIntegerMapTest, PooledStdMap) {
+  using Allocator = PoolAllocator<std::pair<const uint64_t, uint32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::map<uint64_t, uint32_t, std::less<uint64_t>, Allocator> input_map{std::less<uint64_t>(), Allocator(resource)};
+  for (uint32_t i = 0; i < 100; ++i) {
+    input_map.emplace(uint64_t{i} * 7, i);
+  }
+
+  ImmutableIntegerMap<uint64_t, uint32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+  EXPECT_EQ(immutable_map.count(1), 0);
+}
+
+TEST(ImmutableIntegerMapTest, PooledStdUnorderedMap) {
+  using Allocator = PoolAllocator<std::pair<const uint64_t, uint32_t>, FixedPoolResource<100>>;
+
+  FixedPoolResource<100> resource;
+  std::unordered_map<uint64_t, uint32_t, std::hash<uint64_t>, std::equal_to<uint64_t>, Allocator> input_map(
+      0, std::hash<uint64_t>(), std::equal_to<uint64_t>(), Allocator(resource));
+  for (uint32_t i = 0; i < 100; ++i) {
+    input_map.emplace(uint64_t{i} * 7, i);
+  }
+
+  ImmutableIntegerMap<uint64_t, uint32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  // iteration is sorted even though the input wasn't
+  uint64_t expected_key = 0;
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, expected_key);
+    expected_key += 7;
+  }
+}
+
+}  // namespace
+}  // namespace helpers::containers
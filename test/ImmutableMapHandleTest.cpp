@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "containers/ImmutableMap.hpp"
+#include "containers/ImmutableMapHandle.hpp"
+
+namespace helpers::containers {
+namespace {
+
+using Map = ImmutableMap<int32_t, int32_t>;
+
+std::unique_ptr<const Map> MakeMap(int32_t version) {
+  std::map<int32_t, int32_t> input_map;
+  for (int32_t i = 0; i < 16; ++i) {
+    input_map.emplace(i, version);
+  }
+
+  return std::make_unique<const Map>(input_map);
+}
+
+TEST(ImmutableMapHandleTest, ReadAndPublish) {
+  ImmutableMapHandle<Map> handle(MakeMap(1));
+
+  {
+    auto guard = handle.read();
+    EXPECT_EQ(guard->size(), 16);
+    EXPECT_EQ((*guard).at(3), 1);
+  }
+
+  handle.publish(MakeMap(2));
+
+  auto guard = handle.read();
+  EXPECT_EQ(guard->at(3), 2);
+}
+
+TEST(ImmutableMapHandleTest, NestedGuards) {
+  ImmutableMapHandle<Map> handle(MakeMap(1));
+
+  auto outer = handle.read();
+  {
+    auto inner = handle.read();
+    EXPECT_EQ(inner.get(), outer.get());
+  }
+
+  EXPECT_EQ(outer->at(0), 1);
+}
+
+TEST(ImmutableMapHandleTest, OldMapOutlivesPublishWhileRead) {
+  ImmutableMapHandle<Map> handle(MakeMap(1));
+
+  std::atomic<bool> reading{false};
+  std::atomic<bool> published{false};
+
+  std::thread reader([&]() {
+    auto guard = handle.read();
+    reading    = true;
+
+    // publish() can't return while this guard is alive
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(published);
+    EXPECT_EQ(guard->at(0), 1);
+  });
+
+  while (!reading) {
+    std::this_thread::yield();
+  }
+
+  handle.publish(MakeMap(2));
+  published = true;
+
+  reader.join();
+
+  EXPECT_EQ(handle.read()->at(0), 2);
+}
+
+TEST(ImmutableMapHandleTest, ConcurrentReadersAndPublisher) {
+  constexpr int32_t kNumVersions = 200;
+  constexpr size_t  kNumReaders  = 4;
+
+  ImmutableMapHandle<Map> handle(MakeMap(0));
+
+  std::atomic<bool>    done{false};
+  std::vector<int32_t> inconsistent_reads(kNumReaders, 0);
+
+  std::vector<std::thread> readers;
+  for (size_t reader_idx = 0; reader_idx < kNumReaders; ++reader_idx) {
+    readers.emplace_back([&, reader_idx]() {
+      int32_t last_version = 0;
+
+      while (!done) {
+        auto guard = handle.read();
+
+        // every entry of a map carries the same version and versions never go backwards
+        const auto version = guard->at(0);
+        if (guard->at(15) != version || version < last_version) {
+          ++inconsistent_reads[reader_idx];
+        }
+        last_version = version;
+      }
+    });
+  }
+
+  for (int32_t version = 1; version <= kNumVersions; ++version) {
+    handle.publish(MakeMap(version));
+  }
+
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  for (auto count : inconsistent_reads) {
+    EXPECT_EQ(count, 0);
+  }
+
+  EXPECT_EQ(handle.read()->at(7), kNumVersions);
+}
+
+}  // namespace
+}  // namespace helpers::containers
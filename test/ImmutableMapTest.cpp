@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
 
 #include "containers/ImmutableMap.hpp"
+#include "containers/PoolAllocator.hpp"
 
 namespace helpers::containers {
 namespace {
@@ -109,5 +114,134 @@ TEST(ImmutableMapTest, NonIntegralType) {
   }
 }
 
+TEST(ImmutableMapTest, TransparentCompare) {
+  const std::map<std::string, int32_t> input_map = {{"apple", 1}, {"banana", 2}, {"cherry", 3}};
+
+  ImmutableMap<std::string, int32_t, std::less<>> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  EXPECT_EQ(immutable_map.at(std::string_view("banana")), 2);
+  EXPECT_EQ(immutable_map.at("cherry"), 3);
+  EXPECT_EQ(immutable_map["apple"], 1);
+  EXPECT_EQ(immutable_map.at(std::string("apple")), 1);
+
+  EXPECT_EQ(immutable_map.count(std::string_view("banana")), 1);
+  EXPECT_EQ(immutable_map.count("bananas"), 0);
+  EXPECT_EQ(immutable_map.count(std::string_view("")), 0);
+
+  EXPECT_THROW(immutable_map.at(std::string_view("durian")), std::out_of_range);
+}
+
+TEST(ImmutableMapTest, BloomFilter) {
+  std::map<int32_t, int32_t> input_map;
+  for (int32_t i = 0; i < 1000; ++i) {
+    input_map.emplace(i * 2, i);
+  }
+
+  ImmutableMap<int32_t, int32_t, std::less<int32_t>, BlockedBloomFilter<int32_t, 12>> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (int32_t i = 0; i < 2000; ++i) {
+    EXPECT_EQ(immutable_map.count(i), (i % 2 == 0) ? 1 : 0);
+  }
+
+  EXPECT_EQ(immutable_map.at(10), 5);
+  EXPECT_THROW(immutable_map.at(11), std::out_of_range);
+}
+
+TEST(ImmutableMapTest, EmptyBloomFilter) {
+  const std::unordered_map<int32_t, int32_t> input_map;
+
+  ImmutableMap<int32_t, int32_t, std::less<int32_t>, BlockedBloomFilter<int32_t>> immutable_map(input_map);
+
+  EXPECT_TRUE(immutable_map.empty());
+  EXPECT_EQ(immutable_map.count(0), 0);
+}
+
+TEST(ImmutableMapTest, PiecewiseLinearIndex) {
+  std::map<uint64_t, int32_t> input_map;
+  for (int32_t i = 0; i < 5000; ++i) {
+    input_map.emplace(static_cast<uint64_t>(i) * static_cast<uint64_t>(i) * 3, i);
+  }
+
+  ImmutableMap<uint64_t, int32_t, std::less<uint64_t>, NoMembershipFilter<uint64_t>, PiecewiseLinearIndex<uint64_t, 4>>
+      immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.count(k), 1);
+    EXPECT_EQ(immutable_map.at(k), v);
+    EXPECT_EQ(immutable_map.count(k + 1), 0);
+  }
+
+  EXPECT_THROW(immutable_map.at(2), std::out_of_range);
+  EXPECT_EQ(immutable_map.count(std::numeric_limits<uint64_t>::max()), 0);
+}
+
+TEST(ImmutableMapTest, PiecewiseLinearIndexGreaterThanCompare) {
+  const std::map<int32_t, int32_t> input_map = {{1, 2}, {3, 7}, {19, 5}, {2, 12}, {7, 99}};
+
+  ImmutableMap<int32_t, int32_t, std::greater<int32_t>, NoMembershipFilter<int32_t>, PiecewiseLinearIndex<int32_t, 1>>
+      immutable_map(input_map);
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.count(4), 0);
+}
+
+TEST(ImmutableMapTest, PooledStdMap) {
+  using Allocator = PoolAllocator<std::pair<const int32_t, int32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::map<int32_t, int32_t, std::greater<int32_t>, Allocator> input_map{std::greater<int32_t>(), Allocator(resource)};
+  for (int32_t i = 0; i < 100; ++i) {
+    input_map.emplace(i * 3, i);
+  }
+
+  ImmutableMap<int32_t, int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+  EXPECT_EQ(immutable_map.count(1), 0);
+}
+
+TEST(ImmutableMapTest, PooledStdUnorderedMap) {
+  using Allocator = PoolAllocator<std::pair<const std::string, int32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::unordered_map<std::string, int32_t, std::hash<std::string>, std::equal_to<std::string>, Allocator> input_map(
+      0, std::hash<std::string>(), std::equal_to<std::string>(), Allocator(resource));
+  input_map.emplace("banana", 2);
+  input_map.emplace("apple", 1);
+  input_map.emplace("cherry", 3);
+
+  ImmutableMap<std::string, int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  EXPECT_EQ(immutable_map.at("apple"), 1);
+  EXPECT_EQ(immutable_map.at("banana"), 2);
+  EXPECT_EQ(immutable_map.at("cherry"), 3);
+  EXPECT_EQ(immutable_map.begin()->first, "apple");
+}
+
+TEST(ImmutableMapTest, SortedUnique) {
+  std::vector<std::pair<int32_t, int32_t>> values = {{1, 2}, {3, 7}, {7, 99}, {19, 5}};
+
+  ImmutableMap<int32_t, int32_t> immutable_map(sorted_unique, std::move(values));
+
+  ASSERT_EQ(immutable_map.size(), 4);
+  EXPECT_EQ(immutable_map.at(7), 99);
+  EXPECT_EQ(immutable_map.count(2), 0);
+}
+
 }  // namespace
 }  // namespace helpers::containers
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "containers/ImmutableStringMap.hpp"
+#include "containers/PoolAllocator.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(ImmutableStringMapTest, StdMap) {
+  const std::map<std::string, int32_t> input_map = {
+      {"a", 1}, {"abc", 2}, {"abcdefgh", 3}, {"abcdefghi", 4}, {"abcdefghij", 5}, {"b", 6}, {"zzzzzzzzzzzz", 7}};
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.count(k), 1);
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.at("abcdefghi"), 4);
+  EXPECT_EQ(immutable_map[std::string_view("b")], 6);
+
+  EXPECT_EQ(immutable_map.count(""), 0);
+  EXPECT_EQ(immutable_map.count("ab"), 0);
+  EXPECT_EQ(immutable_map.count("abcdefg"), 0);
+  EXPECT_EQ(immutable_map.count("abcdefghijk"), 0);
+  EXPECT_THROW(immutable_map.at("zzzzzzzzzzzzz"), std::out_of_range);
+
+  auto input_map_iter = input_map.begin();
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(k, input_map_iter->first);
+    EXPECT_EQ(v, input_map_iter->second);
+    ++input_map_iter;
+  }
+}
+
+TEST(ImmutableStringMapTest, EmbeddedNullBytes) {
+  const std::map<std::string, int32_t> input_map = {{std::string("ab", 2), 1},
+                                                    {std::string("ab\0", 3), 2},
+                                                    {std::string("ab\0\0\0\0\0\0", 8), 3},
+                                                    {std::string("ab\0\0\0\0\0\0\0x", 10), 4}};
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  EXPECT_EQ(immutable_map.count(std::string_view("ab\0\0", 4)), 0);
+  EXPECT_EQ(immutable_map.count(std::string_view("ab\0\0\0\0\0\0\0", 9)), 0);
+}
+
+TEST(ImmutableStringMapTest, StdUnorderedMap) {
+  const std::unordered_map<std::string, int32_t> input_map = {
+      {"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}, {"\xff\xfe", 5}};
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+
+  // iteration is in byte order, with bytes compared as unsigned values
+  std::string previous_key;
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_LT(previous_key, k);
+    previous_key = std::string(k);
+  }
+  EXPECT_EQ(previous_key, "\xff\xfe");
+}
+
+TEST(ImmutableStringMapTest, EmptyStdMap) {
+  const std::map<std::string, int32_t> input_map;
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  EXPECT_TRUE(immutable_map.empty());
+  EXPECT_EQ(immutable_map.count("a"), 0);
+  EXPECT_THROW(immutable_map.at("a"), std::out_of_range);
+  EXPECT_FALSE(immutable_map.begin() != immutable_map.end());
+}
+
+TEST(ImmutableStringMapTest, BoolValues) {
+  const std::map<std::string, bool> input_map = {{"no", false}, {"yes", true}, {"also yes", true}};
+
+  ImmutableStringMap<bool> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  // the values are returned by reference, so they have to be stored one per bool
+  const bool& yes = immutable_map.at("yes");
+  EXPECT_TRUE(yes);
+  EXPECT_FALSE(immutable_map["no"]);
+  EXPECT_NE(&immutable_map.at("also yes"), &yes);
+
+  for (const auto& [k, v] : immutable_map) {
+    EXPECT_EQ(v, input_map.at(std::string(k)));
+  }
+}
+
+TEST(ImmutableStringMapTest, PooledStdMap) {
+  using Allocator = PoolAllocator<std::pair<const std::string, int32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::map<std::string, int32_t, std::less<std::string>, Allocator> input_map{std::less<std::string>(),
+                                                                              Allocator(resource)};
+  input_map.emplace("b", 2);
+  input_map.emplace("a", 1);
+  input_map.emplace("abcdefghij", 3);
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+  EXPECT_EQ(immutable_map.count("c"), 0);
+}
+
+TEST(ImmutableStringMapTest, PooledStdUnorderedMap) {
+  using Allocator = PoolAllocator<std::pair<const std::string, int32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::unordered_map<std::string, int32_t, std::hash<std::string>, std::equal_to<std::string>, Allocator> input_map(
+      0, std::hash<std::string>(), std::equal_to<std::string>(), Allocator(resource));
+  input_map.emplace("delta", 4);
+  input_map.emplace("alpha", 1);
+  input_map.emplace("charlie", 3);
+
+  ImmutableStringMap<int32_t> immutable_map(input_map);
+
+  ASSERT_EQ(immutable_map.size(), input_map.size());
+
+  for (const auto& [k, v] : input_map) {
+    EXPECT_EQ(immutable_map.at(k), v);
+  }
+  EXPECT_EQ(immutable_map.count("bravo"), 0);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "containers/LayeredImmutableMap.hpp"
+
+namespace helpers::containers {
+namespace {
+
+std::shared_ptr<const ImmutableMap<int32_t, int32_t>> MakeBase() {
+  const std::map<int32_t, int32_t> input_map = {{1, 10}, {3, 30}, {5, 50}, {7, 70}};
+
+  return std::make_shared<const ImmutableMap<int32_t, int32_t>>(input_map);
+}
+
+TEST(LayeredImmutableMapTest, LookupThroughDelta) {
+  LayeredImmutableMap<int32_t, int32_t> layered_map(MakeBase());
+
+  EXPECT_EQ(layered_map.size(), 4);
+  EXPECT_EQ(layered_map.delta_size(), 0);
+
+  layered_map.insert_or_assign(3, 33);
+  layered_map.insert_or_assign(4, 40);
+  layered_map.erase(5);
+  layered_map.erase(6);
+
+  EXPECT_EQ(layered_map.delta_size(), 3);
+  EXPECT_EQ(layered_map.size(), 4);
+
+  EXPECT_EQ(layered_map.at(1), 10);
+  EXPECT_EQ(layered_map.at(3), 33);
+  EXPECT_EQ(layered_map[4], 40);
+  EXPECT_EQ(layered_map.count(5), 0);
+  EXPECT_EQ(layered_map.count(6), 0);
+  EXPECT_THROW(layered_map.at(5), std::out_of_range);
+
+  layered_map.insert_or_assign(5, 55);
+  EXPECT_EQ(layered_map.at(5), 55);
+
+  // the base is never modified
+  EXPECT_EQ(layered_map.base()->at(3), 30);
+  EXPECT_EQ(layered_map.base()->count(4), 0);
+}
+
+TEST(LayeredImmutableMapTest, MergeAndRebase) {
+  LayeredImmutableMap<int32_t, int32_t> layered_map(MakeBase());
+
+  layered_map.insert_or_assign(0, 0);
+  layered_map.insert_or_assign(3, 33);
+  layered_map.insert_or_assign(8, 80);
+  layered_map.erase(1);
+  layered_map.erase(7);
+
+  auto merged = layered_map.merge();
+  layered_map.rebase(merged);
+
+  EXPECT_EQ(layered_map.delta_size(), 0);
+
+  const std::map<int32_t, int32_t> expected = {{0, 0}, {3, 33}, {5, 50}, {8, 80}};
+  ASSERT_EQ(merged.base->size(), expected.size());
+
+  auto expected_iter = expected.begin();
+  for (const auto& [k, v] : *merged.base) {
+    EXPECT_EQ(k, expected_iter->first);
+    EXPECT_EQ(v, expected_iter->second);
+    ++expected_iter;
+  }
+}
+
+TEST(LayeredImmutableMapTest, ChangesDuringMergeSurviveRebase) {
+  LayeredImmutableMap<int32_t, int32_t> layered_map(MakeBase());
+
+  layered_map.insert_or_assign(2, 20);
+  layered_map.insert_or_assign(3, 33);
+
+  // merge a snapshot, like a background thread would
+  const auto snapshot = layered_map;
+  const auto merged   = snapshot.merge();
+
+  layered_map.insert_or_assign(3, 34);
+  layered_map.erase(2);
+  layered_map.insert_or_assign(9, 90);
+
+  layered_map.rebase(merged);
+
+  EXPECT_EQ(layered_map.delta_size(), 3);
+  EXPECT_EQ(layered_map.at(3), 34);
+  EXPECT_EQ(layered_map.count(2), 0);
+  EXPECT_EQ(layered_map.at(9), 90);
+  EXPECT_EQ(layered_map.at(1), 10);
+  EXPECT_EQ(layered_map.size(), 5);
+}
+
+TEST(LayeredImmutableMapTest, OutOfOrderRebaseIsIgnored) {
+  LayeredImmutableMap<int32_t, int32_t> layered_map(MakeBase());
+
+  layered_map.insert_or_assign(2, 20);
+  const auto older = layered_map.merge();
+
+  layered_map.insert_or_assign(4, 40);
+  const auto newer = layered_map.merge();
+
+  EXPECT_TRUE(layered_map.rebase(newer));
+  EXPECT_EQ(layered_map.delta_size(), 0);
+
+  // applying the older merge would drop 4, whose delta entry the newer merge already folded in
+  EXPECT_FALSE(layered_map.rebase(older));
+  EXPECT_EQ(layered_map.base(), newer.base);
+  EXPECT_EQ(layered_map.at(2), 20);
+  EXPECT_EQ(layered_map.at(4), 40);
+
+  // neither is a merge that covers nothing new
+  EXPECT_FALSE(layered_map.rebase(newer));
+}
+
+TEST(LayeredImmutableMapTest, GreaterThanCompare) {
+  const std::map<int32_t, int32_t> input_map = {{1, 10}, {2, 20}, {3, 30}};
+
+  LayeredImmutableMap<int32_t, int32_t, std::greater<int32_t>> layered_map(
+      std::make_shared<const ImmutableMap<int32_t, int32_t, std::greater<int32_t>>>(input_map));
+
+  layered_map.insert_or_assign(4, 40);
+  layered_map.erase(2);
+
+  const auto merged = layered_map.merge();
+
+  int32_t previous_key = 5;
+  for (const auto& [k, v] : *merged.base) {
+    EXPECT_GT(previous_key, k);
+    EXPECT_EQ(v, k * 10);
+    previous_key = k;
+  }
+  EXPECT_EQ(merged.base->size(), 3);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "containers/MappedVector2D.hpp"
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DExpression.hpp"
+
+#include "Vector2DTestHelpers.hpp"
+
+namespace helpers::containers {
+namespace {
+
+class MappedVector2DTest : public ::testing::Test {
+  public:
+    MappedVector2DTest()
+        : path(::testing::TempDir() + "MappedVector2DTest." + std::to_string(::getpid()) + "." +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name()) {}
+
+    ~MappedVector2DTest() override { std::remove(path.c_str()); }
+
+  protected:
+    const std::string path;
+};
+
+TEST_F(MappedVector2DTest, WriteAndMap) {
+    const auto vector = MakeVector<int32_t>(13, 7);
+    write_mapped_vector2d(path, vector);
+
+    const MappedVector2D<const int32_t> mapped(path, MappedVector2D<const int32_t>::Access::kSequential);
+
+    ASSERT_EQ(mapped.capacity().rows, 13);
+    ASSERT_EQ(mapped.capacity().columns, 7);
+    EXPECT_EQ(mapped.stride(), 7);
+
+    for (size_t row = 0; row < 13; ++row) {
+        for (size_t column = 0; column < 7; ++column) {
+            EXPECT_EQ(mapped(row, column), vector(row, column));
+        }
+    }
+
+    EXPECT_EQ(mapped.row(4)[6], 406);
+    EXPECT_EQ(mapped.column(2)[12], 1202);
+    EXPECT_EQ(sum(mapped), sum(vector));
+    EXPECT_THROW(mapped.at(13, 0), std::out_of_range);
+
+    // the elements follow the header, aligned
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.data()) % 64, 0);
+}
+
+TEST_F(MappedVector2DTest, WriteTiledVectorAndExpression) {
+    const auto tiled = MakeVector<int32_t, TiledLayout<4, 4>>(9, 10);
+
+    write_mapped_vector2d(path, tiled * 2);
+
+    const MappedVector2D<const int32_t> mapped(path);
+    for (size_t row = 0; row < 9; ++row) {
+        for (size_t column = 0; column < 10; ++column) {
+            EXPECT_EQ(mapped(row, column), tiled(row, column) * 2);
+        }
+    }
+
+    // back into memory
+    Vector2D<int32_t> copy = mapped + 0;
+    EXPECT_EQ(copy(8, 9), 1618);
+}
+
+TEST_F(MappedVector2DTest, WritesGoToTheFile) {
+    {
+        auto mapped = MappedVector2D<double>::create(path, 100, 50);
+
+        for (const auto element : mapped) {
+            EXPECT_EQ(element, 0.0);
+        }
+
+        mapped(99, 49) = 2.5;
+        mapped.row(3)[4] = -1.0;
+        mapped.sync();
+    }
+
+    {
+        MappedVector2D<double> mapped(path, MappedVector2D<double>::Access::kRandom);
+        EXPECT_EQ(mapped(99, 49), 2.5);
+        EXPECT_EQ(mapped(3, 4), -1.0);
+
+        mapped(0, 0) = 1.0;
+    }
+
+    const MappedVector2D<const double> mapped(path);
+    EXPECT_EQ(mapped(0, 0), 1.0);
+    EXPECT_EQ(sum(mapped), 2.5);
+}
+
+TEST_F(MappedVector2DTest, AccessHints) {
+    write_mapped_vector2d(path, Vector2D<uint8_t>(5000, 3, 1));
+
+    MappedVector2D<const uint8_t> mapped(path);
+    mapped.advise(MappedVector2D<const uint8_t>::Access::kRandom);
+    mapped.will_need(0, 5000);
+    mapped.will_need(4000, 1000);
+    mapped.will_need(5000, 0);
+
+    EXPECT_THROW(mapped.will_need(4000, 1001), std::out_of_range);
+    EXPECT_EQ(sum(mapped + 0), 15000);
+}
+
+TEST_F(MappedVector2DTest, Move) {
+    write_mapped_vector2d(path, MakeVector<int32_t>(3, 3));
+
+    MappedVector2D<const int32_t> mapped(path);
+    MappedVector2D<const int32_t> moved(std::move(mapped));
+    EXPECT_EQ(moved(2, 2), 202);
+
+    // the moved-from grid is empty, rather than pointing into the mapping moved owns
+    EXPECT_EQ(mapped.data(), nullptr);
+    EXPECT_EQ(mapped.capacity().rows, 0);
+    EXPECT_EQ(mapped.capacity().columns, 0);
+    EXPECT_EQ(mapped.begin(), mapped.end());
+
+    auto                          created = MappedVector2D<int32_t>::create(path + ".other", 2, 2);
+    MappedVector2D<const int32_t> other(path + ".other");
+    moved = std::move(other);
+    EXPECT_EQ(moved(1, 1), 0);
+    EXPECT_EQ(moved.capacity().rows, 2);
+
+    EXPECT_EQ(other.data(), nullptr);
+    EXPECT_EQ(other.capacity().rows, 0);
+    EXPECT_EQ(other.begin(), other.end());
+
+    std::remove((path + ".other").c_str());
+}
+
+TEST_F(MappedVector2DTest, Empty) {
+    write_mapped_vector2d(path, Vector2D<float>(0, 4));
+
+    const MappedVector2D<const float> mapped(path);
+    EXPECT_EQ(mapped.capacity().rows, 0);
+    EXPECT_EQ(mapped.capacity().columns, 4);
+    EXPECT_EQ(mapped.begin(), mapped.end());
+}
+
+TEST_F(MappedVector2DTest, Errors) {
+    EXPECT_THROW(MappedVector2D<const int32_t>(path + ".missing"), std::system_error);
+
+    // wrong element type
+    write_mapped_vector2d(path, MakeVector<int32_t>(3, 3));
+    EXPECT_THROW(MappedVector2D<const uint32_t>{path}, std::invalid_argument);
+    EXPECT_THROW(MappedVector2D<const float>{path}, std::invalid_argument);
+
+    // truncated
+    ASSERT_EQ(::truncate(path.c_str(), 64 + 8 * 4), 0);
+    EXPECT_THROW(MappedVector2D<const int32_t>{path}, std::invalid_argument);
+
+    // not a grid at all
+    std::ofstream(path, std::ios::trunc) << "hello";
+    EXPECT_THROW(MappedVector2D<const int32_t>{path}, std::invalid_argument);
+
+    std::ofstream(path, std::ios::trunc) << std::string(200, 'x');
+    EXPECT_THROW(MappedVector2D<const int32_t>{path}, std::invalid_argument);
+}
+
+}  // namespace
+}  // namespace helpers::containers
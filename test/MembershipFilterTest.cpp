@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "containers/MembershipFilter.hpp"
+
+namespace helpers::containers {
+namespace {
+
+/// @brief Orders strings ignoring case, so "Key" and "KEY" are the same key
+struct CaseInsensitiveLess {
+  bool operator()(const std::string& lhs, const std::string& rhs) const {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                        [](char l, char r) { return std::tolower(l) < std::tolower(r); });
+  }
+};
+
+struct CaseInsensitiveHash {
+  size_t operator()(std::string key) const {
+    std::transform(key.begin(), key.end(), key.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+    return std::hash<std::string>()(key);
+  }
+};
+
+static_assert(detail::kFilterAgreesWithCompare<NoMembershipFilter<std::string>, CaseInsensitiveLess>);
+static_assert(detail::kFilterAgreesWithCompare<BlockedBloomFilter<std::string>, std::less<std::string>>);
+static_assert(detail::kFilterAgreesWithCompare<BlockedBloomFilter<int32_t>, std::greater<>>);
+static_assert(!detail::kFilterAgreesWithCompare<BlockedBloomFilter<std::string>, CaseInsensitiveLess>);
+static_assert(
+    detail::kFilterAgreesWithCompare<BlockedBloomFilter<std::string, 10, CaseInsensitiveHash>, CaseInsensitiveLess>);
+
+TEST(MembershipFilterTest, NoMembershipFilter) {
+  NoMembershipFilter<int32_t> filter;
+
+  filter.reserve(10);
+  filter.insert(1);
+
+  EXPECT_TRUE(filter.may_contain(1));
+  EXPECT_TRUE(filter.may_contain(2));
+}
+
+TEST(MembershipFilterTest, EmptyBloomFilter) {
+  BlockedBloomFilter<int32_t> filter;
+
+  EXPECT_FALSE(filter.may_contain(1));
+
+  filter.reserve(0);
+
+  EXPECT_EQ(filter.bit_count(), 512);
+  EXPECT_FALSE(filter.may_contain(1));
+}
+
+TEST(MembershipFilterTest, BloomFilterNoFalseNegatives) {
+  constexpr int32_t kNumKeys = 10000;
+
+  BlockedBloomFilter<int32_t> filter;
+  filter.reserve(kNumKeys);
+
+  for (int32_t i = 0; i < kNumKeys; ++i) {
+    filter.insert(i * 7);
+  }
+
+  for (int32_t i = 0; i < kNumKeys; ++i) {
+    EXPECT_TRUE(filter.may_contain(i * 7));
+  }
+}
+
+TEST(MembershipFilterTest, BloomFilterFalsePositiveRate) {
+  constexpr int32_t kNumKeys = 10000;
+
+  BlockedBloomFilter<int32_t, 10> filter;
+  filter.reserve(kNumKeys);
+
+  for (int32_t i = 0; i < kNumKeys; ++i) {
+    filter.insert(i);
+  }
+
+  constexpr int32_t kNumQueries = 10 * kNumKeys;
+
+  int32_t false_positives = 0;
+  for (int32_t i = kNumKeys; i < kNumKeys + kNumQueries; ++i) {
+    false_positives += filter.may_contain(i) ? 1 : 0;
+  }
+
+  // ~1% is expected at 10 bits per key; leave plenty of headroom for the blocking
+  EXPECT_LT(false_positives, 3 * kNumQueries / 100);
+}
+
+TEST(MembershipFilterTest, BloomFilterStringKeys) {
+  BlockedBloomFilter<std::string, 16> filter;
+  filter.reserve(3);
+
+  filter.insert("alpha");
+  filter.insert("bravo");
+  filter.insert("charlie");
+
+  EXPECT_TRUE(filter.may_contain("alpha"));
+  EXPECT_TRUE(filter.may_contain("bravo"));
+  EXPECT_TRUE(filter.may_contain("charlie"));
+}
+
+TEST(MembershipFilterTest, HasherConsistentWithComparator) {
+  BlockedBloomFilter<std::string, 16, CaseInsensitiveHash> filter;
+
+  filter.reserve(1);
+  filter.insert("Key");
+
+  EXPECT_TRUE(filter.may_contain("KEY"));
+  EXPECT_TRUE(filter.may_contain("key"));
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "containers/PoolAllocator.hpp"
+
+namespace helpers::containers {
+namespace {
+
+template <typename _Key, typename _Tp, typename _Resource>
+using PooledMap = std::map<_Key, _Tp, std::less<_Key>, PoolAllocator<std::pair<const _Key, _Tp>, _Resource>>;
+
+TEST(PoolAllocatorTest, Map) {
+  ChunkedPoolResource<16> resource;
+  PooledMap<uint32_t, std::string, ChunkedPoolResource<16>> map{
+      PoolAllocator<std::pair<const uint32_t, std::string>, ChunkedPoolResource<16>>(resource)};
+
+  for (uint32_t i = 0; i < 100; ++i) {
+    map.emplace(i, std::to_string(i));
+  }
+
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(map.at(42), "42");
+
+  for (uint32_t i = 0; i < 100; i += 2) {
+    map.erase(i);
+  }
+
+  // erased nodes are reused, so the map doesn't grow its pool
+  const auto capacity = resource.capacity();
+  for (uint32_t i = 0; i < 100; i += 2) {
+    map.emplace(i + 1000, "new");
+  }
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(resource.capacity(), capacity);
+}
+
+TEST(PoolAllocatorTest, List) {
+  FixedPoolResource<4> resource;
+  std::list<uint64_t, PoolAllocator<uint64_t, FixedPoolResource<4>>> list{
+      PoolAllocator<uint64_t, FixedPoolResource<4>>(resource)};
+
+  for (uint64_t i = 0; i < 4; ++i) {
+    list.push_back(i);
+  }
+
+  // every node of the fixed pool is in use
+  EXPECT_THROW(list.push_back(4), std::bad_alloc);
+  EXPECT_EQ(list.size(), 4);
+
+  list.pop_front();
+  list.push_back(4);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_EQ(list.back(), 4);
+}
+
+TEST(PoolAllocatorTest, UnorderedMap) {
+  using Allocator = PoolAllocator<std::pair<const std::string, uint32_t>, ChunkedPoolResource<>>;
+
+  ChunkedPoolResource<> resource;
+  std::unordered_map<std::string, uint32_t, std::hash<std::string>, std::equal_to<std::string>, Allocator> map(
+      0, std::hash<std::string>(), std::equal_to<std::string>(), Allocator(resource));
+
+  // the bucket array is allocated with more than one element, and comes from the heap
+  for (uint32_t i = 0; i < 1000; ++i) {
+    map.emplace(std::to_string(i), i);
+  }
+
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_EQ(map.at("999"), 999);
+}
+
+TEST(PoolAllocatorTest, Equality) {
+  ChunkedPoolResource<> resource;
+  ChunkedPoolResource<> other_resource;
+
+  const PoolAllocator<uint32_t, ChunkedPoolResource<>> allocator(resource);
+  const PoolAllocator<uint64_t, ChunkedPoolResource<>> rebound(allocator);
+
+  EXPECT_TRUE(allocator == rebound);
+  EXPECT_EQ(&rebound.resource(), &resource);
+  const PoolAllocator<uint32_t, ChunkedPoolResource<>> other_allocator(other_resource);
+  EXPECT_TRUE(allocator != other_allocator);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "containers/SearchIndex.hpp"
+
+namespace helpers::containers {
+namespace {
+
+template <typename _Index, typename _Key>
+void ExpectEveryKeyInBounds(const _Index& index, const std::vector<_Key>& keys) {
+  for (size_t position = 0; position < keys.size(); ++position) {
+    const auto [lo, hi] = index.search_bound(keys[position], keys.size());
+    EXPECT_LE(lo, position);
+    EXPECT_GT(hi, position);
+  }
+}
+
+TEST(SearchIndexTest, NoSearchIndex) {
+  NoSearchIndex<int32_t> index;
+  index.reserve(10);
+  index.insert(1);
+
+  const auto [lo, hi] = index.search_bound(1, 10);
+  EXPECT_EQ(lo, 0);
+  EXPECT_EQ(hi, 10);
+}
+
+TEST(SearchIndexTest, LinearKeysUseOneSegment) {
+  std::vector<uint64_t> keys;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    keys.push_back(1'600'000'000'000 + i * 1000);
+  }
+
+  PiecewiseLinearIndex<uint64_t, 8> index;
+  index.reserve(keys.size());
+  for (auto key : keys) {
+    index.insert(key);
+  }
+
+  EXPECT_EQ(index.segment_count(), 1);
+  ExpectEveryKeyInBounds(index, keys);
+
+  const auto [lo, hi] = index.search_bound(keys[5000], keys.size());
+  EXPECT_LE(hi - lo, 2 * 8 + 3);
+}
+
+TEST(SearchIndexTest, RandomKeys) {
+  std::mt19937_64                        rg{42};
+  std::uniform_int_distribution<int64_t> pick(-1'000'000'000, 1'000'000'000);
+
+  std::set<int64_t> unique_keys;
+  while (unique_keys.size() < 50000) {
+    unique_keys.insert(pick(rg));
+  }
+  const std::vector<int64_t> keys(unique_keys.begin(), unique_keys.end());
+
+  PiecewiseLinearIndex<int64_t, 16> index;
+  index.reserve(keys.size());
+  for (auto key : keys) {
+    index.insert(key);
+  }
+
+  EXPECT_LT(index.segment_count(), keys.size() / 16);
+  ExpectEveryKeyInBounds(index, keys);
+
+  // keys outside of the indexed range
+  EXPECT_EQ(index.search_bound(-2'000'000'000, keys.size()).second, 0);
+  EXPECT_LE(index.search_bound(2'000'000'000, keys.size()).second, keys.size());
+}
+
+TEST(SearchIndexTest, QuadraticDoubleKeys) {
+  std::vector<double> keys;
+  for (int32_t i = 0; i < 10000; ++i) {
+    keys.push_back(0.5 * i * i);
+  }
+
+  PiecewiseLinearIndex<double, 4> index;
+  index.reserve(keys.size());
+  for (auto key : keys) {
+    index.insert(key);
+  }
+
+  EXPECT_GT(index.segment_count(), 1);
+  ExpectEveryKeyInBounds(index, keys);
+}
+
+TEST(SearchIndexTest, UnsortedKeysDisableIndex) {
+  PiecewiseLinearIndex<int32_t> index;
+  index.reserve(3);
+  index.insert(3);
+  index.insert(2);
+  index.insert(1);
+
+  const auto [lo, hi] = index.search_bound(2, 3);
+  EXPECT_EQ(lo, 0);
+  EXPECT_EQ(hi, 3);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "containers/SparseVector2D.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(SparseVector2DTest, Empty) {
+    const SparseVector2D<int32_t> vector(1000, 1000, -1);
+
+    EXPECT_EQ(vector.capacity().rows, 1000);
+    EXPECT_EQ(vector.capacity().columns, 1000);
+    EXPECT_EQ(vector.num_stored(), 0);
+    EXPECT_EQ(vector.at(999, 999), -1);
+    EXPECT_TRUE(vector.row(500).empty());
+    EXPECT_FALSE(vector.contains(0, 0));
+}
+
+TEST(SparseVector2DTest, BuildInAnyOrder) {
+    SparseVector2D<int32_t>::Builder builder(10, 20);
+    builder.insert(7, 3, 73);
+    builder.insert(0, 19, 19);
+    builder.insert(7, 1, 71);
+    builder.insert(2, 5, 25);
+    builder.insert(7, 18, 718);
+    EXPECT_EQ(builder.size(), 5);
+
+    const auto vector = builder.build();
+    EXPECT_EQ(builder.size(), 0);
+    EXPECT_EQ(vector.num_stored(), 5);
+
+    EXPECT_EQ(vector.at(7, 1), 71);
+    EXPECT_EQ(vector.at(7, 3), 73);
+    EXPECT_EQ(vector.at(7, 18), 718);
+    EXPECT_EQ(vector(0, 19), 19);
+    EXPECT_EQ(vector(2, 5), 25);
+
+    // absent elements read as the default
+    EXPECT_EQ(vector.at(7, 2), 0);
+    EXPECT_EQ(vector.at(9, 19), 0);
+    EXPECT_TRUE(vector.contains(7, 18));
+    EXPECT_FALSE(vector.contains(7, 17));
+    EXPECT_FALSE(vector.contains(10, 0));
+}
+
+TEST(SparseVector2DTest, RowIteration) {
+    SparseVector2D<double>::Builder builder(3, 100, 1.0);
+    for (size_t column = 100; column-- > 0;) {
+        if (column % 10 == 0) {
+            builder.insert(1, column, static_cast<double>(column));
+        }
+    }
+
+    const auto vector = builder.build();
+
+    const auto row = vector.row(1);
+    ASSERT_EQ(row.size(), 10);
+    for (size_t i = 0; i < row.size(); ++i) {
+        EXPECT_EQ(row.columns[i], i * 10);
+        EXPECT_EQ(row.values[i], static_cast<double>(i * 10));
+    }
+
+    double total = 0.0;
+    for (const auto value : row.values) {
+        total += value;
+    }
+    EXPECT_EQ(total, 450.0);
+
+    EXPECT_TRUE(vector.row(0).empty());
+    EXPECT_TRUE(vector.row(2).empty());
+    EXPECT_THROW(vector.row(3), std::out_of_range);
+}
+
+TEST(SparseVector2DTest, LastInsertWins) {
+    SparseVector2D<std::string>::Builder builder(2, 2, "empty");
+    builder.insert(1, 1, "first");
+    builder.insert(0, 0, "other");
+    builder.insert(1, 1, "second");
+    builder.insert(1, 1, "third");
+
+    const auto vector = builder.build();
+    EXPECT_EQ(vector.num_stored(), 2);
+    EXPECT_EQ(vector.at(1, 1), "third");
+    EXPECT_EQ(vector.at(0, 1), "empty");
+}
+
+TEST(SparseVector2DTest, BoolOccupancyGrid) {
+    SparseVector2D<bool>::Builder builder(4, 8);
+    builder.insert(1, 2, true);
+    builder.insert(1, 6, true);
+    builder.insert(3, 0, false);
+
+    const auto grid = builder.build();
+    EXPECT_TRUE(grid.at(1, 2));
+    EXPECT_TRUE(grid(1, 6));
+    EXPECT_FALSE(grid.at(1, 3));
+    EXPECT_FALSE(grid.at(3, 0));
+    EXPECT_TRUE(grid.contains(3, 0));
+
+    const auto row = grid.row(1);
+    ASSERT_EQ(row.size(), 2);
+    EXPECT_EQ(row.columns[1], 6);
+    EXPECT_TRUE(row.values[0]);
+    EXPECT_TRUE(row.values[1]);
+    EXPECT_EQ(&row.values[0], &grid.at(1, 2));
+
+    // copies own their values
+    auto copy = grid;
+    EXPECT_TRUE(copy.at(1, 6));
+    EXPECT_NE(&copy.at(1, 6), &grid.at(1, 6));
+    copy = SparseVector2D<bool>(2, 2);
+    EXPECT_EQ(copy.num_stored(), 0);
+    EXPECT_TRUE(grid.at(1, 6));
+}
+
+TEST(SparseVector2DTest, OutOfRange) {
+    SparseVector2D<int32_t>::Builder builder(4, 5);
+    EXPECT_THROW(builder.insert(4, 0, 1), std::out_of_range);
+    EXPECT_THROW(builder.insert(0, 5, 1), std::out_of_range);
+
+    const auto vector = builder.build();
+    EXPECT_THROW(vector.at(4, 0), std::out_of_range);
+    EXPECT_THROW(vector.at(0, 5), std::out_of_range);
+}
+
+TEST(SparseVector2DTest, IndexTypeMustHoldEveryColumn) {
+    EXPECT_NO_THROW((SparseVector2D<int32_t, uint8_t>(1, 256)));
+    EXPECT_THROW((SparseVector2D<int32_t, uint8_t>(1, 257)), std::invalid_argument);
+    EXPECT_THROW((SparseVector2D<int32_t, uint16_t>::Builder(1, 70000)), std::invalid_argument);
+
+    SparseVector2D<int32_t, size_t>::Builder builder(2, 1ULL << 40);
+    builder.insert(1, (1ULL << 40) - 1, 5);
+    EXPECT_EQ(builder.build().at(1, (1ULL << 40) - 1), 5);
+}
+
+TEST(SparseVector2DTest, ForEachAndDense) {
+    SparseVector2D<int32_t>::Builder builder(6, 7, -1);
+    builder.insert(5, 6, 56);
+    builder.insert(0, 0, 0);
+    builder.insert(3, 2, 32);
+
+    const auto vector = builder.build();
+
+    std::vector<int32_t> visited;
+    vector.for_each([&](size_t row, size_t column, int32_t value) {
+        EXPECT_EQ(static_cast<int32_t>(row * 10 + column), value);
+        visited.push_back(value);
+    });
+    EXPECT_EQ(visited, (std::vector<int32_t>{0, 32, 56}));
+
+    const auto dense = vector.to_dense<TiledLayout<4, 4>>();
+    for (size_t row = 0; row < 6; ++row) {
+        for (size_t column = 0; column < 7; ++column) {
+            EXPECT_EQ(dense(row, column), vector(row, column));
+        }
+    }
+    EXPECT_EQ(sum(dense), 0 + 32 + 56 - 39);
+}
+
+}  // namespace
+}  // namespace helpers::containers
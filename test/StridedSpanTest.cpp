@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "containers/StridedSpan.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(StridedSpanTest, Access) {
+    std::array<uint32_t, 12> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    // every third value, starting at 1
+    StridedSpan<uint32_t> span(&values[1], 4, 3);
+
+    EXPECT_EQ(span.size(), 4);
+    EXPECT_EQ(span.stride(), 3);
+    EXPECT_EQ(span[0], 1);
+    EXPECT_EQ(span[3], 10);
+    EXPECT_EQ(span.front(), 1);
+    EXPECT_EQ(span.back(), 10);
+    EXPECT_EQ(span.at(2), 7);
+    EXPECT_THROW(span.at(4), std::out_of_range);
+
+    span[1] = 40;
+    EXPECT_EQ(values[4], 40);
+}
+
+TEST(StridedSpanTest, RandomAccessIterators) {
+    std::array<int32_t, 10> values{9, 0, 7, 0, 5, 0, 3, 0, 1, 0};
+
+    StridedSpan<int32_t> span(values.data(), 5, 2);
+
+    static_assert(std::is_same<std::iterator_traits<StridedSpan<int32_t>::iterator>::iterator_category,
+                                                          std::random_access_iterator_tag>::value);
+
+    EXPECT_EQ(std::distance(span.begin(), span.end()), 5);
+    EXPECT_EQ(*(span.begin() + 2), 5);
+    EXPECT_EQ(span.end()[-1], 1);
+
+    // sorting the span only moves the values it covers
+    std::sort(span.begin(), span.end());
+    EXPECT_EQ(values, (std::array<int32_t, 10>{1, 0, 3, 0, 5, 0, 7, 0, 9, 0}));
+}
+
+TEST(StridedSpanTest, ConstConversion) {
+    std::array<uint32_t, 4> values{1, 2, 3, 4};
+
+    StridedSpan<uint32_t>       span(values.data(), 4, 1);
+    StridedSpan<const uint32_t> const_span = span;
+
+    static_assert(!std::is_convertible<StridedSpan<const uint32_t>, StridedSpan<uint32_t>>::value);
+
+    uint32_t sum = 0;
+    for (const auto value : const_span) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 10);
+}
+
+TEST(StridedSpanTest, Empty) {
+    StridedSpan<uint32_t> span;
+
+    EXPECT_TRUE(span.empty());
+    EXPECT_EQ(span.begin(), span.end());
+}
+
+}  // namespace
+}  // namespace helpers::containers
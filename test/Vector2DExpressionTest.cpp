@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DExpression.hpp"
+#include "containers/Vector2DView.hpp"
+
+#include "Vector2DTestHelpers.hpp"
+
+namespace helpers::containers {
+namespace {
+
+template <typename _Layout>
+class Vector2DExpressionTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(Vector2DExpressionTest, Vector2DLayouts<double>);
+
+TYPED_TEST(Vector2DExpressionTest, ElementWiseArithmetic) {
+    const auto a = MakeVector<double, TypeParam>(9, 11);
+    const auto b = MakeVector<double, TypeParam>(9, 11, 1.0);
+
+    Vector2D<double, TypeParam> result(1, 1);
+    result = a * 2.0 + b - a / b;
+
+    ASSERT_EQ(result.capacity().rows, 9);
+    ASSERT_EQ(result.capacity().columns, 11);
+
+    for (size_t row = 0; row < 9; ++row) {
+        for (size_t column = 0; column < 11; ++column) {
+            const double expected = a(row, column) * 2.0 + b(row, column) - a(row, column) / b(row, column);
+            EXPECT_DOUBLE_EQ(result(row, column), expected);
+        }
+    }
+}
+
+TYPED_TEST(Vector2DExpressionTest, ScalarOnEitherSide) {
+    const auto a = MakeVector<double, TypeParam>(5, 6);
+
+    Vector2D<double, TypeParam> result = 1.0 - a * 3.0 + (10.0 / (a + 1.0));
+
+    for (size_t row = 0; row < 5; ++row) {
+        for (size_t column = 0; column < 6; ++column) {
+            EXPECT_DOUBLE_EQ(result(row, column), 1.0 - a(row, column) * 3.0 + 10.0 / (a(row, column) + 1.0));
+        }
+    }
+}
+
+TYPED_TEST(Vector2DExpressionTest, Reductions) {
+    const auto a = MakeVector<double, TypeParam>(7, 13, -50.0);
+
+    double expected_sum = 0.0;
+    for (const auto value : a) {
+        expected_sum += value;
+    }
+
+    EXPECT_DOUBLE_EQ(sum(a), expected_sum);
+    EXPECT_DOUBLE_EQ(min(a), -50.0);
+    EXPECT_DOUBLE_EQ(max(a), 612.0 - 50.0);
+
+    // reductions fuse with the expression
+    EXPECT_DOUBLE_EQ(max(-a), 50.0);
+    EXPECT_DOUBLE_EQ(sum(a * 0.0 + 1.0), 7.0 * 13.0);
+}
+
+TYPED_TEST(Vector2DExpressionTest, Subviews) {
+    auto       a = MakeVector<double, TypeParam>(8, 8);
+    const auto b = MakeVector<double, TypeParam>(8, 8);
+
+    // a region of one vector combined with a region of another
+    Vector2D<double, TypeParam> result = a.subview(1, 2, 3, 4) + b.subview(4, 4, 3, 4);
+    EXPECT_DOUBLE_EQ(result(0, 0), 102.0 + 404.0);
+    EXPECT_DOUBLE_EQ(result(2, 3), 305.0 + 607.0);
+
+    EXPECT_DOUBLE_EQ(sum(b.subview(0, 0, 2, 2)), 0.0 + 1.0 + 100.0 + 101.0);
+}
+
+TEST(Vector2DExpressionTest, CompoundAssignmentAliasesItself) {
+    auto       a = MakeVector<float>(4, 5);
+    const auto b = MakeVector<float>(4, 5, 1.0f);
+
+    a = a * 2.0f + b;
+    EXPECT_FLOAT_EQ(a(3, 4), 304.0f * 2.0f + 305.0f);
+
+    a += b;
+    a *= 0.5f;
+    a -= 1.0f;
+    EXPECT_FLOAT_EQ(a(3, 4), (304.0f * 2.0f + 305.0f + 305.0f) * 0.5f - 1.0f);
+
+    // every element is at least 1 now
+    a += 1.0f;
+    a /= a;
+    EXPECT_FLOAT_EQ(sum(a), 20.0f);
+}
+
+TEST(Vector2DExpressionTest, MixedLayouts) {
+    const auto a = MakeVector<float>(6, 7);
+    const auto b = MakeVector<float, TiledLayout<4, 4>>(6, 7);
+
+    Vector2D<float, TiledLayout<2, 2>> result = a - b;
+    EXPECT_FLOAT_EQ(min(result), 0.0f);
+    EXPECT_FLOAT_EQ(max(result), 0.0f);
+}
+
+TEST(Vector2DExpressionTest, IntegerElements) {
+    const auto a = MakeVector<int32_t>(3, 3);
+
+    Vector2D<int32_t> result = a * 2 - 1;
+    EXPECT_EQ(result(2, 2), 403);
+    EXPECT_EQ(sum(result), 2 * (0 + 1 + 2 + 100 + 101 + 102 + 200 + 201 + 202) - 9);
+}
+
+/// Container the expression core knows nothing about, other than that view() returns a Vector2DView
+struct ThreeOnes {
+    Vector2DView<const int32_t, RowMajorLayout> view() const noexcept {
+        return Vector2DView<const int32_t, RowMajorLayout>(ones, 3, 0, 0, 1, 3);
+    }
+
+    int32_t ones[3] = {1, 1, 1};
+};
+
+TEST(Vector2DExpressionTest, ContainerWithView) {
+    static_assert(detail::kIsVector2DOperand<ThreeOnes>);
+
+    const ThreeOnes container;
+    EXPECT_EQ(sum(container * 2), 6);
+}
+
+TEST(Vector2DExpressionTest, DimensionMismatch) {
+    const auto a = MakeVector<double>(3, 4);
+    const auto b = MakeVector<double>(4, 3);
+
+    EXPECT_THROW(a + b, std::invalid_argument);
+
+    auto c = MakeVector<double>(3, 4);
+    EXPECT_THROW(c += b, std::invalid_argument);
+
+    const Vector2D<double> empty(0, 0);
+    EXPECT_EQ(sum(empty), 0.0);
+    EXPECT_THROW(min(empty), std::invalid_argument);
+    EXPECT_THROW(max(empty), std::invalid_argument);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "containers/FixedVector2D.hpp"
+#include "containers/ParallelFor.hpp"
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DParallel.hpp"
+
+#include "Vector2DTestHelpers.hpp"
+
+namespace helpers::containers {
+namespace {
+
+TEST(ParallelForBlocksTest, BlocksCoverEveryItemOnce) {
+    for (size_t num_items : {0, 1, 7, 64, 1000}) {
+        for (size_t num_threads : {1, 3, 8}) {
+            std::vector<std::atomic<int32_t>> visits(num_items);
+
+            detail::ParallelForBlocks(num_items, 4, num_threads, [&](size_t, size_t first_item, size_t end_item) {
+                EXPECT_EQ(first_item % 4, 0);
+
+                for (size_t item = first_item; item < end_item; ++item) {
+                    ++visits[item];
+                }
+            });
+
+            for (const auto& num_visits : visits) {
+                EXPECT_EQ(num_visits, 1);
+            }
+        }
+    }
+}
+
+TEST(ParallelForBlocksTest, NumBlocks) {
+    EXPECT_EQ(detail::NumParallelBlocks(0, 1, 4), 0);
+    EXPECT_EQ(detail::NumParallelBlocks(10, 4, 8), 3);
+    EXPECT_EQ(detail::NumParallelBlocks(1000, 1, 8), 8);
+    EXPECT_GE(detail::NumParallelBlocks(1000, 1, 0), 1);
+}
+
+TEST(ParallelForBlocksTest, RethrowsOnceEveryBlockIsDone) {
+    std::atomic<int32_t> num_blocks_done{0};
+
+    EXPECT_THROW(detail::ParallelForBlocks(100, 1, 4,
+                                           [&](size_t block_idx, size_t, size_t) {
+                                               ++num_blocks_done;
+                                               if (block_idx == 2) {
+                                                   throw std::runtime_error("");
+                                               }
+                                           }),
+                 std::runtime_error);
+
+    EXPECT_EQ(num_blocks_done, 4);
+}
+
+template <typename _Layout>
+class Vector2DParallelTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(Vector2DParallelTest, Vector2DLayouts<int64_t>);
+
+TYPED_TEST(Vector2DParallelTest, ForRows) {
+    Vector2D<int64_t, TypeParam> vector(37, 13, -1);
+
+    parallel_for_rows(
+        vector,
+        [](size_t row_idx, auto row) {
+            size_t column = 0;
+            for (auto& element : row) {
+                element = static_cast<int64_t>(row_idx * 100 + column++);
+            }
+        },
+        4);
+
+    EXPECT_EQ(vector(0, 0), 0);
+    for (size_t row = 0; row < 37; ++row) {
+        for (size_t column = 0; column < 13; ++column) {
+            EXPECT_EQ(vector(row, column), static_cast<int64_t>(row * 100 + column));
+        }
+    }
+}
+
+TYPED_TEST(Vector2DParallelTest, ForRowsOfView) {
+    Vector2D<int64_t, TypeParam> vector(20, 20, 0);
+
+    parallel_for_rows(
+        vector.subview(3, 5, 10, 4),
+        [](size_t, auto row) {
+            for (auto& element : row) {
+                element = 1;
+            }
+        },
+        3);
+
+    int64_t total = 0;
+    for (const auto& element : vector) {
+        total += element;
+    }
+    EXPECT_EQ(total, 40);
+    EXPECT_EQ(vector(3, 5), 1);
+    EXPECT_EQ(vector(12, 8), 1);
+    EXPECT_EQ(vector(13, 8), 0);
+}
+
+TYPED_TEST(Vector2DParallelTest, Transform) {
+    const auto a = MakeVector<int64_t, TypeParam>(41, 17);
+    const auto b = MakeVector<int64_t, TypeParam>(41, 17);
+
+    Vector2D<int64_t, TypeParam> result(41, 17);
+    parallel_transform(
+        a * 2 + b, result, [](int64_t value) { return value + 1; }, 5);
+
+    for (size_t row = 0; row < 41; ++row) {
+        for (size_t column = 0; column < 17; ++column) {
+            EXPECT_EQ(result(row, column), a(row, column) * 3 + 1);
+        }
+    }
+}
+
+TYPED_TEST(Vector2DParallelTest, TransformInPlace) {
+    auto vector = MakeVector<int64_t, TypeParam>(30, 9);
+
+    parallel_transform(
+        vector, vector, [](int64_t value) { return -value; }, 4);
+
+    for (size_t row = 0; row < 30; ++row) {
+        for (size_t column = 0; column < 9; ++column) {
+            EXPECT_EQ(vector(row, column), -static_cast<int64_t>(row * 100 + column));
+        }
+    }
+}
+
+TYPED_TEST(Vector2DParallelTest, TransformDimensionMismatch) {
+    const auto                   a = MakeVector<int64_t, TypeParam>(4, 5);
+    Vector2D<int64_t, TypeParam> result(5, 4);
+
+    EXPECT_THROW(parallel_transform(a, result, [](int64_t value) { return value; }), std::invalid_argument);
+}
+
+TYPED_TEST(Vector2DParallelTest, Reduce) {
+    const auto vector = MakeVector<int64_t, TypeParam>(53, 19);
+
+    for (size_t num_threads : {1, 2, 7, 0}) {
+        EXPECT_EQ(parallel_reduce(vector, 0, std::plus<>(), num_threads), sum(vector));
+        EXPECT_EQ(parallel_reduce(vector, std::numeric_limits<int64_t>::lowest(), detail::Maximum(), num_threads),
+                  5218);
+        EXPECT_EQ(parallel_reduce(vector * 2, 0, std::plus<>(), num_threads), sum(vector) * 2);
+    }
+
+    const Vector2D<int64_t, TypeParam> empty(0, 0);
+    EXPECT_EQ(parallel_reduce(empty, 0, std::plus<>()), 0);
+}
+
+TEST(Vector2DParallelReduceTest, BoolResults) {
+    FixedVector2D<bool, 16, 4> flags;
+    EXPECT_FALSE(parallel_reduce(flags, false, std::logical_or<>(), 8));
+
+    // every thread writes its own partial result; bools packed into one word would race
+    flags(11, 2) = true;
+    EXPECT_TRUE(parallel_reduce(flags, false, std::logical_or<>(), 8));
+}
+
+TYPED_TEST(Vector2DParallelTest, FirstTouch) {
+    Vector2D<int64_t, TypeParam> vector(parallel_first_touch, 45, 23, 7, 4);
+
+    ASSERT_EQ(vector.capacity().rows, 45);
+    ASSERT_EQ(vector.capacity().columns, 23);
+    EXPECT_EQ(parallel_reduce(vector, 0, std::plus<>(), 4), 45 * 23 * 7);
+    EXPECT_EQ(min(vector), 7);
+    EXPECT_EQ(max(vector), 7);
+}
+
+}  // namespace
+}  // namespace helpers::containers
@@ -1,9 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "containers/Vector2D.hpp"
 
+#include "Vector2DTestHelpers.hpp"
+
 namespace helpers::containers {
 namespace {
 
@@ -28,6 +35,12 @@ struct NoDefaultCtor {
     uint32_t value;
 };
 
+/// Not trivially default constructible, so default-initializing it would leave count indeterminate
+struct Cell {
+    std::string name;
+    int         count;
+};
+
 TEST_F(Vector2DTest, EmptyVector) {
     auto dims = vector.capacity();
 
@@ -83,5 +96,327 @@ TEST_F(Vector2DTest, TypeWithoutDefaultConstructor) {
     EXPECT_EQ(vec.at(height / 2, width / 2).value, default_value.value);
 }
 
+TEST_F(Vector2DTest, OutOfRange) {
+    EXPECT_THROW(vector.at(height, 0), std::out_of_range);
+    EXPECT_THROW(vector.at(0, width), std::out_of_range);
+}
+
+TEST_F(Vector2DTest, ElementsAreValueInitialized) {
+    for (const auto element : vector) {
+        ASSERT_EQ(element, 0);
+    }
+
+    // growing allocates new elements, which start at 0 too
+    vector.resize(height + 10, width);
+    for (const auto element : vector) {
+        ASSERT_EQ(element, 0);
+    }
+}
+
+TEST(Vector2DValueInitTest, NonTrivialAggregate) {
+    Vector2D<Cell> vector(4, 4);
+    for (const auto& cell : vector) {
+        ASSERT_TRUE(cell.name.empty());
+        ASSERT_EQ(cell.count, 0);
+    }
+
+    // growing the rows reuses the storage, growing the columns reallocates it
+    vector.resize(8, 4);
+    vector.resize(8, 9);
+    for (const auto& cell : vector) {
+        ASSERT_EQ(cell.count, 0);
+    }
+
+    vector.reshape(10, 10);
+    for (const auto& cell : vector) {
+        ASSERT_EQ(cell.count, 0);
+    }
+}
+
+TEST(Vector2DTiledTest, AccessAndIteration) {
+    // neither dimension is a multiple of the tile size, so the edge tiles are partially used
+    constexpr size_t rows    = 19;
+    constexpr size_t columns = 21;
+
+    Vector2D<uint32_t, TiledLayout<4, 8>> vector(rows, columns);
+
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t column = 0; column < columns; ++column) {
+            vector(row, column) = row * columns + column;
+        }
+    }
+
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t column = 0; column < columns; ++column) {
+            EXPECT_EQ(vector.at(row, column), row * columns + column);
+        }
+    }
+
+    // iteration is row-major whatever the layout
+    uint32_t i = 0;
+    for (const auto& element : vector) {
+        EXPECT_EQ(element, i++);
+    }
+    EXPECT_EQ(i, rows * columns);
+
+    EXPECT_THROW(vector.at(rows, 0), std::out_of_range);
+    EXPECT_THROW(vector.at(0, columns), std::out_of_range);
+}
+
+TEST(Vector2DTiledTest, ColumnNeighboursShareTile) {
+    Vector2D<uint32_t, TiledLayout<8, 8>> vector(64, 64);
+
+    // within a tile, the element below is one tile row further
+    EXPECT_EQ(&vector(1, 3) - &vector(0, 3), 8);
+
+    // the next tile starts right after the last element of the current one
+    EXPECT_EQ(&vector(0, 8) - &vector(7, 7), 1);
+}
+
+TEST(Vector2DTiledTest, ForEachByTile) {
+    constexpr size_t rows    = 5;
+    constexpr size_t columns = 6;
+
+    Vector2D<uint32_t, TiledLayout<4, 4>> vector(rows, columns);
+
+    std::vector<std::pair<size_t, size_t>> visited;
+    const uint32_t*                        p_previous       = nullptr;
+    bool                                   in_storage_order = true;
+
+    vector.for_each_by_tile([&](size_t row, size_t column, uint32_t& element) {
+        // elements of a tile row are adjacent in memory
+        if (p_previous != nullptr && column % 4 != 0 && &element != p_previous + 1) {
+            in_storage_order = false;
+        }
+
+        p_previous = &element;
+        visited.emplace_back(row, column);
+    });
+
+    EXPECT_TRUE(in_storage_order);
+
+    // first tile covers rows [0, 4) and columns [0, 4), the second one columns [4, 6), then the last tile row
+    std::vector<std::pair<size_t, size_t>> expected;
+    for (const auto [first_row, end_row, first_column, end_column] :
+         std::vector<std::array<size_t, 4>>{{0, 4, 0, 4}, {0, 4, 4, 6}, {4, 5, 0, 4}, {4, 5, 4, 6}}) {
+        for (size_t row = first_row; row < end_row; ++row) {
+            for (size_t column = first_column; column < end_column; ++column) {
+                expected.emplace_back(row, column);
+            }
+        }
+    }
+
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(Vector2DTiledTest, RowMajorForEachByTile) {
+    Vector2D<uint32_t> vector(3, 4);
+
+    const auto& const_vector = vector;
+
+    size_t num_visited = 0;
+    const_vector.for_each_by_tile([&](size_t row, size_t column, const uint32_t& element) {
+        EXPECT_EQ(&element, &const_vector(row, column));
+        EXPECT_EQ(row * 4 + column, num_visited++);
+    });
+
+    EXPECT_EQ(num_visited, 12);
+}
+
+TEST(Vector2DTiledTest, Resize) {
+    Vector2D<uint32_t, TiledLayout<8, 8>> vector(4, 4);
+
+    vector.resize(20, 30);
+    vector(19, 29) = 7;
+    EXPECT_EQ(vector.at(19, 29), 7);
+
+    auto dims = vector.capacity();
+    EXPECT_EQ(dims.rows, 20);
+    EXPECT_EQ(dims.columns, 30);
+}
+
+TEST(Vector2DPaddedTest, RowsAreAligned) {
+    constexpr size_t rows    = 7;
+    constexpr size_t columns = 100;
+
+    AlignedVector2D<float> vector(rows, columns);
+
+    // 100 floats padded to a multiple of 16 floats, ie 64 bytes
+    EXPECT_EQ(vector.stride(), 112);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(vector.data()) % 64, 0);
+
+    for (size_t row = 0; row < rows; ++row) {
+        EXPECT_EQ(&vector(row, 0), vector.data() + row * vector.stride());
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&vector(row, 0)) % 64, 0);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(vector.row(row).data()) % 64, 0);
+    }
+
+    EXPECT_EQ(vector.column(3).stride(), 112);
+}
+
+TEST(Vector2DPaddedTest, IterationSkipsPadding) {
+    constexpr size_t rows    = 3;
+    constexpr size_t columns = 5;
+
+    Vector2D<uint32_t, PaddedRowMajorLayout<uint32_t, 32>> vector(rows, columns, 0);
+    EXPECT_EQ(vector.stride(), 8);
+
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t column = 0; column < columns; ++column) {
+            vector(row, column) = row * columns + column;
+        }
+    }
+
+    uint32_t i = 0;
+    for (const auto element : vector) {
+        EXPECT_EQ(element, i++);
+    }
+    EXPECT_EQ(i, rows * columns);
+
+    // the padding is initialized, so whole padded rows can be read
+    EXPECT_EQ(vector.data()[columns], 0);
+    EXPECT_THROW(vector.at(0, columns), std::out_of_range);
+}
+
+TEST(Vector2DPaddedTest, Resize) {
+    AlignedVector2D<double, 32> vector(2, 3);
+    EXPECT_EQ(vector.stride(), 4);
+
+    vector.resize(10, 9);
+    EXPECT_EQ(vector.stride(), 12);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(vector.data()) % 32, 0);
+
+    vector(9, 8) = 1.5;
+    EXPECT_EQ(vector.at(9, 8), 1.5);
+}
+
+/// Numbering starts at 1 in the resize tests, so that no numbered element looks value-initialized
+constexpr uint32_t kFirstNumber = 1;
+
+template <typename _Layout>
+class Vector2DResizeTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(Vector2DResizeTest, Vector2DLayouts<uint32_t>);
+
+TYPED_TEST(Vector2DResizeTest, ResizeKeepsElementsInPlace) {
+    Vector2D<uint32_t, TypeParam> vector(5, 7);
+    Number(vector, kFirstNumber);
+
+    // more columns reallocate, more rows extend the storage
+    vector.resize(9, 11);
+    ExpectNumbered(vector, 5, 7, kFirstNumber);
+
+    vector.resize(13, 6);
+    ExpectNumbered(vector, 5, 6, kFirstNumber);
+
+    vector.resize(3, 3);
+    ExpectNumbered(vector, 3, 3, kFirstNumber);
+
+    // the elements dropped by the shrink don't come back
+    vector.resize(10, 10);
+    ExpectNumbered(vector, 3, 3, kFirstNumber);
+}
+
+TYPED_TEST(Vector2DResizeTest, ResizeWithinReserveDoesntReallocate) {
+    Vector2D<uint32_t, TypeParam> vector(4, 4);
+    Number(vector, kFirstNumber);
+
+    vector.reserve(32, 20);
+    EXPECT_EQ(vector.reserved().rows, 32);
+    EXPECT_EQ(vector.reserved().columns, 20);
+    ExpectNumbered(vector, 4, 4, kFirstNumber);
+
+    const auto* p_data = vector.data();
+
+    for (size_t size = 5; size <= 20; ++size) {
+        vector.resize(size, size);
+        ExpectNumbered(vector, 4, 4, kFirstNumber);
+        EXPECT_EQ(vector.data(), p_data);
+    }
+
+    vector.resize(32, 1);
+    EXPECT_EQ(vector.data(), p_data);
+
+    // reserve never shrinks
+    vector.reserve(1, 1);
+    EXPECT_EQ(vector.reserved().rows, 32);
+    EXPECT_EQ(vector.reserved().columns, 20);
+}
+
+TYPED_TEST(Vector2DResizeTest, ResizeAmortizesColumnGrowth) {
+    Vector2D<uint32_t, TypeParam> vector(3, 8);
+    Number(vector, kFirstNumber);
+
+    vector.resize(3, 9);
+    EXPECT_EQ(vector.reserved().columns, 12);
+    EXPECT_EQ(vector.capacity().columns, 9);
+    ExpectNumbered(vector, 3, 8, kFirstNumber);
+
+    const auto* p_data = vector.data();
+    vector.resize(3, 12);
+    EXPECT_EQ(vector.data(), p_data);
+
+    // rows reserved earlier are kept
+    vector.reserve(6, 12);
+    vector.resize(3, 13);
+    EXPECT_EQ(vector.reserved().rows, 6);
+    EXPECT_EQ(vector.reserved().columns, 18);
+    ExpectNumbered(vector, 3, 8, kFirstNumber);
+}
+
+TYPED_TEST(Vector2DResizeTest, ColumnsGrowingOneAtATimeRarelyReallocate) {
+    Vector2D<uint32_t, TypeParam> vector(4, 1);
+
+    size_t num_reallocations = 0;
+    for (size_t num_columns = 2; num_columns <= 1000; ++num_columns) {
+        const auto reserved_columns = vector.reserved().columns;
+        vector.resize(4, num_columns);
+        num_reallocations += vector.reserved().columns != reserved_columns ? 1 : 0;
+    }
+
+    EXPECT_LE(num_reallocations, 20);
+    EXPECT_LE(vector.reserved().columns, 1500);
+}
+
+TYPED_TEST(Vector2DResizeTest, ShrinkToFit) {
+    Vector2D<uint32_t, TypeParam> vector(6, 6);
+    Number(vector, kFirstNumber);
+
+    vector.reserve(40, 40);
+    vector.resize(5, 3);
+    vector.shrink_to_fit();
+
+    EXPECT_EQ(vector.reserved().rows, 5);
+    EXPECT_EQ(vector.reserved().columns, 3);
+    ExpectNumbered(vector, 5, 3, kFirstNumber);
+}
+
+TEST(Vector2DReshapeTest, KeepsRowMajorOrder) {
+    Vector2D<uint32_t> vector(4, 6);
+
+    uint32_t i = 0;
+    for (auto& element : vector) {
+        element = i++;
+    }
+
+    const auto* p_data = vector.data();
+    vector.reshape(2, 12);
+
+    EXPECT_EQ(vector.data(), p_data);
+    EXPECT_EQ(vector.capacity().rows, 2);
+    EXPECT_EQ(vector.capacity().columns, 12);
+
+    i = 0;
+    for (const auto element : vector) {
+        EXPECT_EQ(element, i++);
+    }
+    EXPECT_EQ(vector(1, 0), 12);
+
+    // growing the storage keeps the existing elements too
+    vector.reshape(5, 6);
+    EXPECT_EQ(vector(3, 5), 23);
+    EXPECT_EQ(vector(4, 5), 0);
+}
+
 }  // namespace
 }  // namespace helpers::containers
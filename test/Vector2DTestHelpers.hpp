@@ -0,0 +1,53 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DLayout.hpp"
+
+namespace helpers::containers {
+
+/// @brief Layouts the typed Vector2D tests run with; rows of _Tp are padded to 32 bytes
+template <typename _Tp>
+using Vector2DLayouts = ::testing::Types<RowMajorLayout, TiledLayout<4, 4>, PaddedRowMajorLayout<_Tp, 32>>;
+
+/// @brief Sets element (row, column) to row * 100 + column + offset
+template <typename _Vector>
+void Number(_Vector& vector, typename _Vector::value_type offset = 0) {
+    using value_type = typename _Vector::value_type;
+
+    for (size_t row = 0; row < vector.capacity().rows; ++row) {
+        for (size_t column = 0; column < vector.capacity().columns; ++column) {
+            vector(row, column) = static_cast<value_type>(row * 100 + column) + offset;
+        }
+    }
+}
+
+/// @brief Vector where element (row, column) is row * 100 + column + offset
+template <typename _Tp, typename _Layout = RowMajorLayout>
+Vector2D<_Tp, _Layout> MakeVector(size_t num_rows, size_t num_columns, _Tp offset = 0) {
+    Vector2D<_Tp, _Layout> vector(num_rows, num_columns);
+    Number(vector, offset);
+
+    return vector;
+}
+
+/// @brief Checks that the elements within num_rows x num_columns are still numbered, and that the others are 0
+template <typename _Vector>
+void ExpectNumbered(const _Vector& vector, size_t num_rows, size_t num_columns,
+                    typename _Vector::value_type offset = 0) {
+    using value_type = typename _Vector::value_type;
+
+    for (size_t row = 0; row < vector.capacity().rows; ++row) {
+        for (size_t column = 0; column < vector.capacity().columns; ++column) {
+            const value_type expected = row < num_rows && column < num_columns
+                                            ? static_cast<value_type>(row * 100 + column) + offset
+                                            : value_type();
+            EXPECT_EQ(vector(row, column), expected) << row << ", " << column;
+        }
+    }
+}
+
+}  // namespace helpers::containers
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "containers/Vector2D.hpp"
+#include "containers/Vector2DView.hpp"
+
+#include "Vector2DTestHelpers.hpp"
+
+namespace helpers::containers {
+namespace {
+
+template <typename _Layout>
+class Vector2DViewTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(Vector2DViewTest, Vector2DLayouts<uint32_t>);
+
+TYPED_TEST(Vector2DViewTest, Row) {
+    auto vector = MakeVector<uint32_t, TypeParam>(10, 13);
+
+    auto row = vector.row(7);
+    EXPECT_EQ(std::distance(row.begin(), row.end()), 13);
+    EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0u), 13 * 700 + (12 * 13) / 2);
+
+    std::fill(row.begin(), row.end(), 1);
+    EXPECT_EQ(vector(7, 12), 1);
+    EXPECT_EQ(vector(6, 12), 612);
+    EXPECT_EQ(vector(8, 0), 800);
+
+    EXPECT_THROW(vector.row(10), std::out_of_range);
+}
+
+TYPED_TEST(Vector2DViewTest, Column) {
+    auto vector = MakeVector<uint32_t, TypeParam>(10, 13);
+
+    const auto column = vector.column(5);
+
+    std::vector<uint32_t> values(column.begin(), column.end());
+    std::vector<uint32_t> expected;
+    for (uint32_t row = 0; row < 10; ++row) {
+        expected.push_back(row * 100 + 5);
+    }
+    EXPECT_EQ(values, expected);
+
+    std::transform(column.begin(), column.end(), column.begin(), [](uint32_t value) { return value + 1; });
+    EXPECT_EQ(vector(9, 5), 906);
+    EXPECT_EQ(vector(9, 4), 904);
+
+    EXPECT_THROW(vector.column(13), std::out_of_range);
+}
+
+TYPED_TEST(Vector2DViewTest, Subview) {
+    auto vector = MakeVector<uint32_t, TypeParam>(10, 13);
+
+    // straddles tile boundaries in both directions
+    auto region = vector.subview(3, 2, 5, 7);
+
+    EXPECT_EQ(region.dimensions().rows, 5);
+    EXPECT_EQ(region.dimensions().columns, 7);
+    EXPECT_EQ(region(0, 0), 302);
+    EXPECT_EQ(region.at(4, 6), 708);
+    EXPECT_THROW(region.at(5, 0), std::out_of_range);
+
+    std::vector<uint32_t> visited(region.begin(), region.end());
+    ASSERT_EQ(visited.size(), 35);
+    EXPECT_EQ(visited.front(), 302);
+    EXPECT_EQ(visited[7], 402);
+    EXPECT_EQ(visited.back(), 708);
+
+    // a view's rows, columns and subviews are relative to the view
+    EXPECT_EQ(*region.row(1).begin(), 402);
+    EXPECT_EQ(*region.column(6).begin(), 308);
+    EXPECT_EQ(region.subview(1, 1, 2, 2)(1, 1), 504);
+
+    std::fill(region.begin(), region.end(), 0);
+    EXPECT_EQ(std::count(vector.begin(), vector.end(), 0u), 35 + 1);
+
+    EXPECT_THROW(vector.subview(3, 2, 8, 7), std::out_of_range);
+    EXPECT_THROW(region.subview(0, 5, 1, 3), std::out_of_range);
+}
+
+TYPED_TEST(Vector2DViewTest, ConstViews) {
+    const auto vector = MakeVector<uint32_t, TypeParam>(6, 6);
+
+    auto region = vector.subview(1, 1, 2, 2);
+    static_assert(std::is_same<decltype(region), Vector2DView<const uint32_t, TypeParam>>::value);
+    EXPECT_EQ(*std::max_element(region.begin(), region.end()), 202);
+
+    auto mutable_vector = MakeVector<uint32_t, TypeParam>(6, 6);
+
+    Vector2DView<const uint32_t, TypeParam> const_view = mutable_vector.view();
+    EXPECT_EQ(const_view(5, 5), 505);
+}
+
+TYPED_TEST(Vector2DViewTest, EmptyViews) {
+    auto vector = MakeVector<uint32_t, TypeParam>(4, 4);
+
+    auto no_columns = vector.subview(1, 2, 3, 0);
+    EXPECT_TRUE(no_columns.empty());
+    EXPECT_EQ(no_columns.begin(), no_columns.end());
+
+    auto no_rows = vector.subview(4, 0, 0, 4);
+    EXPECT_EQ(no_rows.begin(), no_rows.end());
+}
+
+TEST(Vector2DViewRowMajorTest, RowsAndColumnsAreStridedSpans) {
+    auto vector = MakeVector<uint32_t, RowMajorLayout>(4, 6);
+
+    auto column = vector.column(2);
+    static_assert(std::is_same<decltype(column), StridedSpan<uint32_t>>::value);
+    EXPECT_EQ(column.stride(), 6);
+
+    // random access, so the column can be sorted in place
+    std::sort(column.begin(), column.end(), [](uint32_t lhs, uint32_t rhs) { return lhs > rhs; });
+    EXPECT_EQ(vector(0, 2), 302);
+    EXPECT_EQ(vector(3, 2), 2);
+
+    EXPECT_EQ(vector.row(1).data(), &vector(1, 0));
+}
+
+}  // namespace
+}  // namespace helpers::containers